@@ -39,12 +39,15 @@
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 
@@ -57,6 +60,137 @@ int hipblas_bench_datafile()
     return ret;
 }
 
+// Run the tests of the data file with GEMM tuning on, then write the solutions found to a
+// database for HIPBLAS_GEMM_TUNING_DB
+int hipblas_bench_tune(const std::string& path)
+{
+    hipblasStatus_t status = hipblasSetGemmTuning(1);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "Cannot tune GEMMs: " << hipblasStatusToString(status) << std::endl;
+        return -1;
+    }
+
+    int ret = hipblas_bench_datafile();
+    hipblasSetGemmTuning(0);
+
+    status = hipblasSaveGemmTuning(path.c_str());
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "Cannot write tuning database " << path << ": "
+                  << hipblasStatusToString(status) << std::endl;
+        return -1;
+    }
+    std::cout << "# tuning database written to " << path << std::endl;
+    return ret;
+}
+
+// Layout of a HIPBLAS_LAYER=record trace, see hipblasLogRecordHeader in library/src/logging.cpp
+constexpr char     hipblas_replay_magic[8] = {'h', 'i', 'p', 'B', 'L', 'A', 'S', 'R'};
+constexpr uint32_t hipblas_replay_version  = 1;
+
+struct hipblas_replay_record
+{
+    uint32_t line_size;
+    uint32_t thread;
+    uint32_t handle;
+    uint32_t stream;
+    uint64_t time_ns;
+};
+
+// Re-issue the calls of a HIPBLAS_LAYER=record trace in recorded order. Every call of a recorded
+// handle runs on one hipBLAS handle, on a stream matching the recorded stream assignment, and
+// device buffers are kept from call to call, so workspace and cache state carry over between
+// calls as they did when the trace was recorded.
+int hipblas_bench_replay(const std::string& path, const Arguments& base)
+{
+    std::ifstream trace(path, std::ios::binary);
+    if(!trace)
+        throw std::invalid_argument("Cannot open replay trace " + path);
+
+    char     magic[sizeof(hipblas_replay_magic)];
+    uint32_t version = 0;
+    trace.read(magic, sizeof(magic));
+    trace.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if(!trace || memcmp(magic, hipblas_replay_magic, sizeof(magic)))
+        throw std::invalid_argument(path + " is not a hipBLAS record trace");
+    if(version != hipblas_replay_version)
+        throw std::invalid_argument("Unsupported hipBLAS record trace version "
+                                    + std::to_string(version));
+
+    // Read and check the whole trace first, so a bad record does not stop a replay halfway
+    std::vector<std::pair<hipblas_replay_record, std::string>> records;
+    hipblas_replay_record                                      record;
+    while(trace.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        std::string line(record.line_size, '\0');
+        if(!trace.read(&line[0], line.size()))
+            throw std::invalid_argument(path + " is truncated");
+
+        Arguments   arg(base);
+        std::string bench = hipblas_parse_bench_line(line, arg);
+#ifndef HIPBLAS_V2
+        // The _v2 functions only exist in hipblas_v2-bench; it can replay the other calls too
+        if(bench == "hipblas_v2-bench")
+            throw std::invalid_argument("Call " + std::to_string(records.size()) + " of " + path
+                                        + " was logged for hipblas_v2-bench; replay the trace "
+                                          "with hipblas_v2-bench");
+#endif
+        records.emplace_back(record, line);
+    }
+
+    std::map<uint32_t, hipStream_t>     streams{{0, nullptr}};
+    std::map<uint32_t, hipblasHandle_t> handles;
+    hipblas_client_set_device_cache(true);
+
+    int ret = 0;
+    for(size_t call = 0; call < records.size(); ++call)
+    {
+        const hipblas_replay_record& rec  = records[call].first;
+        const std::string&           line = records[call].second;
+
+        auto stream = streams.find(rec.stream);
+        if(stream == streams.end())
+        {
+            hipStream_t s;
+            CHECK_HIP_ERROR(hipStreamCreate(&s));
+            stream = streams.emplace(rec.stream, s).first;
+        }
+
+        auto handle = handles.find(rec.handle);
+        if(handle == handles.end())
+        {
+            hipblasHandle_t h;
+            CHECK_HIPBLAS_ERROR(hipblasCreate(&h));
+            handle = handles.emplace(rec.handle, h).first;
+        }
+
+        Arguments arg(base);
+        hipblas_parse_bench_line(line, arg);
+        arg.cold_iters = 0;
+        arg.iters      = 1;
+
+        std::cout << "# replay " << call << ": thread " << rec.thread << ", handle " << rec.handle
+                  << ", stream " << rec.stream << ", " << rec.time_ns << " ns: " << line
+                  << std::endl;
+
+        hipblas_client_set_handle(handle->second);
+        hipblas_client_set_stream(stream->second);
+        ret |= run_bench_test(arg, 0, 1);
+    }
+
+    hipblas_client_set_handle(nullptr);
+    hipblas_client_set_stream(nullptr);
+    for(auto& handle : handles)
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(handle.second));
+    for(auto& stream : streams)
+        if(stream.second)
+            CHECK_HIP_ERROR(hipStreamDestroy(stream.second));
+    hipblas_client_set_device_cache(false);
+    test_cleanup::cleanup();
+    return ret;
+}
+
 void thread_init_device(int id, const Arguments& arg)
 {
     int count;
@@ -142,6 +276,8 @@ try
     std::string compute_type;
     std::string compute_type_gemm;
     std::string initialization;
+    std::string replay;
+    std::string tune;
     int         device_id;
     int         parallel_devices;
     int32_t     api     = 0;
@@ -228,6 +364,11 @@ try
          "Specific stride of strided_batched vector y, is only applicable to strided batched"
          "BLAS_2: leading dimension.")
 
+        ("stride_alpha",
+         value<hipblasStride>(&arg.stride_alpha)->default_value(0),
+         "Stride between the alpha, and the beta, of consecutive instances of gemm_batched_ex and "
+         "gemm_strided_batched_ex. 0 shares one alpha and beta.")
+
         ("incx",
          value<int64_t>(&arg.incx)->default_value(1),
          "increment between values in x vector")
@@ -337,6 +478,11 @@ try
          value<uint32_t>(&arg.flags)->default_value(0),
          "gemm_ex flags")
 
+        ("epilogue",
+         value<uint32_t>(&arg.epilogue)->default_value(0),
+         "Stages of the epilogue of gemm_ex and gemm_strided_batched_ex, see "
+         "hipblasSetGemmEpilogue: a sum of 1 (bias), 2 (ReLU) or 4 (GELU), and 8 (aux)")
+
         ("atomics_not_allowed",
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
@@ -369,6 +515,15 @@ try
          value<int32_t>(&api)->default_value(0),
          "Use API, supercedes fortran flag (0==C, 1==C_64, ...)")
 
+        ("replay",
+         value<std::string>(&replay),
+         "Re-issue the calls of a trace recorded with HIPBLAS_LAYER=record")
+
+        ("tune",
+         value<std::string>(&tune),
+         "Tune the GEMMs of the --yaml tests and write their solutions to this file, "
+         "to be named by HIPBLAS_GEMM_TUNING_DB")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
@@ -414,6 +569,13 @@ try
         throw std::invalid_argument("Invalid Device ID");
     set_device(device_id);
 
+    if(!tune.empty())
+    {
+        if(!datafile)
+            throw std::invalid_argument("--tune needs the GEMMs to tune given with --yaml");
+        return hipblas_bench_tune(tune);
+    }
+
     if(datafile)
         return hipblas_bench_datafile();
 
@@ -448,6 +610,9 @@ try
     if(arg.initialization == static_cast<hipblas_initialization>(0)) // invalid enum
         throw std::invalid_argument("Invalid value for --initialization " + initialization);
 
+    if(!replay.empty())
+        return hipblas_bench_replay(replay, arg);
+
     if(arg.M < 0)
         throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
     if(arg.N < 0)
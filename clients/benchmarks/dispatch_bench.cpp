@@ -0,0 +1,340 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// hipblas-dispatch-bench measures the host cost of the hipBLAS wrappers themselves. It is
+// linked against a null rocBLAS that returns success without touching the device, so the
+// time per call is argument conversion, logging checks and workspace bookkeeping only, and
+// it runs on machines without a GPU.
+
+#include "program_options.hpp"
+
+#include <hipblas/hipblas.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    constexpr int dispatch_dim   = 4;
+    constexpr int dispatch_batch = 8;
+
+    // Host storage standing in for device memory. The null backend never dereferences it, and
+    // hipblas-dispatch-bench is only built against the null backend; linked against a real
+    // backend these calls would hand host pointers to device kernels.
+    struct dispatch_buffers
+    {
+        float               alpha = 1.0f;
+        float               beta  = 0.0f;
+        std::vector<float>  a, b, c;
+        std::vector<float*> a_array, b_array, c_array;
+
+        dispatch_buffers()
+            : a(dispatch_dim * dispatch_dim * dispatch_batch)
+            , b(dispatch_dim * dispatch_dim * dispatch_batch)
+            , c(dispatch_dim * dispatch_dim * dispatch_batch)
+        {
+            for(int i = 0; i < dispatch_batch; i++)
+            {
+                a_array.push_back(a.data() + i * dispatch_dim * dispatch_dim);
+                b_array.push_back(b.data() + i * dispatch_dim * dispatch_dim);
+                c_array.push_back(c.data() + i * dispatch_dim * dispatch_dim);
+            }
+        }
+    };
+
+    hipblasStatus_t dispatch_sgemm(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasSgemm(handle,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            n,
+                            n,
+                            n,
+                            &d.alpha,
+                            d.a.data(),
+                            n,
+                            d.b.data(),
+                            n,
+                            &d.beta,
+                            d.c.data(),
+                            n);
+    }
+
+    hipblasStatus_t dispatch_gemm_ex(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasGemmEx_v2(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                n,
+                                n,
+                                n,
+                                &d.alpha,
+                                d.a.data(),
+                                HIP_R_32F,
+                                n,
+                                d.b.data(),
+                                HIP_R_32F,
+                                n,
+                                &d.beta,
+                                d.c.data(),
+                                HIP_R_32F,
+                                n,
+                                HIPBLAS_COMPUTE_32F,
+                                HIPBLAS_GEMM_DEFAULT);
+    }
+
+    hipblasStatus_t dispatch_strsm(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasStrsm(handle,
+                            HIPBLAS_SIDE_LEFT,
+                            HIPBLAS_FILL_MODE_LOWER,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_DIAG_NON_UNIT,
+                            n,
+                            n,
+                            &d.alpha,
+                            d.a.data(),
+                            n,
+                            d.b.data(),
+                            n);
+    }
+
+    hipblasStatus_t dispatch_sgemm_batched(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasSgemmBatched(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   n,
+                                   n,
+                                   n,
+                                   &d.alpha,
+                                   d.a_array.data(),
+                                   n,
+                                   d.b_array.data(),
+                                   n,
+                                   &d.beta,
+                                   d.c_array.data(),
+                                   n,
+                                   dispatch_batch);
+    }
+
+    hipblasStatus_t dispatch_sgemm_strided_batched(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasSgemmStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          n,
+                                          n,
+                                          &d.alpha,
+                                          d.a.data(),
+                                          n,
+                                          n * n,
+                                          d.b.data(),
+                                          n,
+                                          n * n,
+                                          &d.beta,
+                                          d.c.data(),
+                                          n,
+                                          n * n,
+                                          dispatch_batch);
+    }
+
+    hipblasStatus_t dispatch_strsm_batched(hipblasHandle_t handle, dispatch_buffers& d)
+    {
+        const int n = dispatch_dim;
+        return hipblasStrsmBatched(handle,
+                                   HIPBLAS_SIDE_LEFT,
+                                   HIPBLAS_FILL_MODE_LOWER,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_DIAG_NON_UNIT,
+                                   n,
+                                   n,
+                                   &d.alpha,
+                                   d.a_array.data(),
+                                   n,
+                                   d.b_array.data(),
+                                   n,
+                                   dispatch_batch);
+    }
+
+    struct dispatch_case
+    {
+        const char* name;
+        hipblasStatus_t (*call)(hipblasHandle_t, dispatch_buffers&);
+    };
+
+    constexpr dispatch_case dispatch_cases[] = {
+        {"hipblasSgemm", dispatch_sgemm},
+        {"hipblasGemmEx_v2", dispatch_gemm_ex},
+        {"hipblasStrsm", dispatch_strsm},
+        {"hipblasSgemmBatched", dispatch_sgemm_batched},
+        {"hipblasSgemmStridedBatched", dispatch_sgemm_strided_batched},
+        {"hipblasStrsmBatched", dispatch_strsm_batched},
+    };
+
+    // Time iters calls on each of threads threads, each with its own handle, and return
+    // the mean nanoseconds per call seen by a thread, or a negative value on failure
+    double dispatch_time(const dispatch_case& test, int threads, int64_t iters, int64_t warmup)
+    {
+        std::atomic<int>         ready{0};
+        std::atomic<bool>        start{false};
+        std::atomic<bool>        failed{false};
+        std::vector<double>      thread_ns(threads);
+        std::vector<std::thread> workers;
+
+        for(int t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&, t] {
+                dispatch_buffers buffers;
+                hipblasHandle_t  handle;
+                if(hipblasCreate(&handle) != HIPBLAS_STATUS_SUCCESS)
+                {
+                    failed = true;
+                    ready++;
+                    return;
+                }
+
+                // Warm up caches, including the workspace size remembered for trsm
+                for(int64_t i = 0; i < warmup; i++)
+                    if(test.call(handle, buffers) != HIPBLAS_STATUS_SUCCESS)
+                        failed = true;
+
+                ready++;
+                while(!start)
+                    std::this_thread::yield();
+
+                auto begin = std::chrono::steady_clock::now();
+                for(int64_t i = 0; i < iters; i++)
+                    if(test.call(handle, buffers) != HIPBLAS_STATUS_SUCCESS)
+                        failed = true;
+                auto end = std::chrono::steady_clock::now();
+
+                thread_ns[t] = std::chrono::duration<double, std::nano>(end - begin).count();
+                hipblasDestroy(handle);
+            });
+        }
+
+        while(ready < threads)
+            std::this_thread::yield();
+        start = true;
+
+        for(auto& worker : workers)
+            worker.join();
+
+        if(failed)
+            return -1.0;
+
+        double total_ns = 0;
+        for(double ns : thread_ns)
+            total_ns += ns;
+        return total_ns / threads / iters;
+    }
+}
+
+int main(int argc, char* argv[])
+try
+{
+    int64_t     iters;
+    int64_t     warmup;
+    int         max_threads;
+    std::string filter;
+
+    options_description desc("hipblas-dispatch-bench command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("iters,i",
+         value<int64_t>(&iters)->default_value(100000),
+         "Timed calls per thread")
+
+        ("warmup,j",
+         value<int64_t>(&warmup)->default_value(100),
+         "Untimed calls per thread before timing")
+
+        ("threads,t",
+         value<int>(&max_threads)->default_value(8),
+         "Largest thread count; counts are doubled from 1 up to this value")
+
+        ("function,f",
+         value<std::string>(&filter)->default_value(""),
+         "Only time wrappers whose name contains this string")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(iters <= 0 || warmup < 0 || max_threads <= 0)
+    {
+        std::cerr << "Invalid value for --iters, --warmup or --threads" << std::endl;
+        return -1;
+    }
+
+    int status = 0;
+    std::cout << "function,threads,ns_per_call" << std::endl;
+    for(const auto& test : dispatch_cases)
+    {
+        if(std::string(test.name).find(filter) == std::string::npos)
+            continue;
+
+        for(int threads = 1; threads <= max_threads; threads *= 2)
+        {
+            double ns = dispatch_time(test, threads, iters, warmup);
+            if(ns < 0)
+            {
+                std::cerr << test.name << " failed with " << threads << " threads" << std::endl;
+                status = -1;
+                break;
+            }
+            std::printf("%s,%d,%.1f\n", test.name, threads, ns);
+        }
+    }
+    return status;
+}
+catch(const std::exception& e)
+{
+    std::cerr << "hipblas-dispatch-bench error: " << e.what() << std::endl;
+    return -1;
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+  Generate a null backend: one definition for every function exported by the
+  rocBLAS or rocSOLVER headers, each returning success without doing any work.
+  Functions already defined in an override source are skipped.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+EXPORT_RE = re.compile(r'\b(?:ROCBLAS|ROCSOLVER)_EXPORT\b([^;{(]*?)\b(\w+)\s*\(')
+OVERRIDE_RE = re.compile(r'\bNULL_BACKEND_API\b[^;{(]*?\b(\w+)\s*\(')
+COMMENT_RE = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+MACRO_RE = re.compile(r'\b[A-Z][A-Z0-9_]*\b(\s*\([^)]*\))?')
+
+
+def exported_functions(header, prefix):
+    with open(header, encoding='utf-8', errors='replace') as f:
+        text = COMMENT_RE.sub(' ', f.read())
+    for match in EXPORT_RE.finditer(text):
+        name = match.group(2)
+        if name.startswith(prefix):
+            # Drop deprecation and attribute macros, keep the return type
+            yield name, ' '.join(MACRO_RE.sub(' ', match.group(1)).split())
+
+
+def definition(name, return_type):
+    # Arguments are never read, and the functions have C linkage, so an empty parameter
+    # list is ABI-compatible with every caller. rocblas_status_success, false and 0 all
+    # return as a zeroed integer register.
+    if return_type == 'void':
+        return f'NULL_BACKEND_API void {name}() {{}}\n'
+    if 'char' in return_type and '*' in return_type:
+        return f'NULL_BACKEND_API const char* {name}() {{ return ""; }}\n'
+    if '*' in return_type:
+        return f'NULL_BACKEND_API void* {name}() {{ return nullptr; }}\n'
+    return f'NULL_BACKEND_API int {name}() {{ return 0; }}\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[-1])
+    parser.add_argument('-o', '--output', required=True, help='generated source file')
+    parser.add_argument('-p', '--prefix', required=True, help='exported function prefix')
+    parser.add_argument('--override', action='append', default=[],
+                        help='source file whose NULL_BACKEND_API functions are skipped')
+    parser.add_argument('include_dirs', nargs='+', help='directories searched for headers')
+    args = parser.parse_args()
+
+    skip = set()
+    for source in args.override:
+        with open(source, encoding='utf-8') as f:
+            skip.update(OVERRIDE_RE.findall(COMMENT_RE.sub(' ', f.read())))
+
+    functions = {}
+    for include_dir in args.include_dirs:
+        for root, _, files in os.walk(include_dir):
+            for header in sorted(files):
+                if header.endswith('.h'):
+                    for name, return_type in exported_functions(os.path.join(root, header),
+                                                                args.prefix):
+                        if name not in skip:
+                            functions.setdefault(name, return_type)
+
+    if not functions:
+        sys.exit(f'{sys.argv[0]}: no {args.prefix}* exports found in {args.include_dirs}')
+
+    contents = ['// Generated by gen_null_backend.py, do not edit\n\n',
+                '#define NULL_BACKEND_API extern "C" __attribute__((visibility("default")))\n\n']
+    contents += [definition(name, functions[name]) for name in sorted(functions)]
+
+    # Only touch the output when it changes, so an unchanged backend is not rebuilt
+    contents = ''.join(contents)
+    if os.path.exists(args.output):
+        with open(args.output, encoding='utf-8') as f:
+            if f.read() == contents:
+                return
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(contents)
+
+
+if __name__ == '__main__':
+    main()
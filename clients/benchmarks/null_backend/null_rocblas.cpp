@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Stateful part of the null rocBLAS backend used by hipblas-dispatch-bench. Every other
+// rocBLAS export is generated by gen_null_backend.py and returns success immediately.
+// The rocBLAS headers are deliberately not included: only the handle is ever inspected,
+// and the generated definitions would conflict with their prototypes.
+
+#include <cstddef>
+
+#define NULL_BACKEND_API extern "C" __attribute__((visibility("default")))
+
+namespace
+{
+    // Values of rocblas_status and rocblas_pointer_mode
+    constexpr int null_status_success         = 0;
+    constexpr int null_status_invalid_handle  = 1;
+    constexpr int null_status_invalid_pointer = 3;
+    constexpr int null_status_memory_error    = 5;
+    constexpr int null_pointer_mode_host      = 0;
+
+    // Device memory the trsm family claims to need, so hipblasDemandAlloc takes its
+    // allocation-failure path on the first call and its cached-size path afterwards
+    constexpr size_t null_trsm_workspace = size_t(1) << 20;
+
+    struct null_handle
+    {
+        void*  stream       = nullptr;
+        int    pointer_mode = null_pointer_mode_host;
+        size_t memory_size  = 0;
+        bool   size_query   = false;
+    };
+
+    int null_trsm(null_handle* handle)
+    {
+        if(!handle)
+            return null_status_invalid_handle;
+        if(!handle->size_query && handle->memory_size < null_trsm_workspace)
+            return null_status_memory_error;
+        return null_status_success;
+    }
+}
+
+NULL_BACKEND_API int rocblas_create_handle(null_handle** handle)
+{
+    if(!handle)
+        return null_status_invalid_pointer;
+    *handle = new null_handle;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_destroy_handle(null_handle* handle)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    delete handle;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_set_stream(null_handle* handle, void* stream)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    handle->stream = stream;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_get_stream(null_handle* handle, void** stream)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    if(!stream)
+        return null_status_invalid_pointer;
+    *stream = handle->stream;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_set_pointer_mode(null_handle* handle, int pointer_mode)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    handle->pointer_mode = pointer_mode;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_get_pointer_mode(null_handle* handle, int* pointer_mode)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    if(!pointer_mode)
+        return null_status_invalid_pointer;
+    *pointer_mode = handle->pointer_mode;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_get_device_memory_size(null_handle* handle, size_t* size)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    if(!size)
+        return null_status_invalid_pointer;
+    *size = handle->memory_size;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_set_device_memory_size(null_handle* handle, size_t size)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    handle->memory_size = size;
+    return null_status_success;
+}
+
+NULL_BACKEND_API bool rocblas_is_user_managing_device_memory(null_handle*)
+{
+    return false;
+}
+
+NULL_BACKEND_API bool rocblas_is_device_memory_size_query(null_handle* handle)
+{
+    return handle && handle->size_query;
+}
+
+NULL_BACKEND_API int rocblas_start_device_memory_size_query(null_handle* handle)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    handle->size_query = true;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_stop_device_memory_size_query(null_handle* handle, size_t* size)
+{
+    if(!handle)
+        return null_status_invalid_handle;
+    if(!size)
+        return null_status_invalid_pointer;
+    handle->size_query = false;
+    *size              = null_trsm_workspace;
+    return null_status_success;
+}
+
+NULL_BACKEND_API int rocblas_strsm(null_handle* handle)
+{
+    return null_trsm(handle);
+}
+
+NULL_BACKEND_API int rocblas_strsm_batched(null_handle* handle)
+{
+    return null_trsm(handle);
+}
+
+NULL_BACKEND_API int rocblas_strsm_strided_batched(null_handle* handle)
+{
+    return null_trsm(handle);
+}
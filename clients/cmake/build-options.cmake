@@ -17,6 +17,10 @@ if( NOT BUILD_CLIENTS_BENCHMARKS )
   option( BUILD_CLIENTS_BENCHMARKS "Build hipBLAS benchmarks" OFF )
 endif( )
 
+if( NOT BUILD_CLIENTS_DISPATCH_BENCHMARK )
+  option( BUILD_CLIENTS_DISPATCH_BENCHMARK "Build hipBLAS dispatch-overhead benchmark against a null rocBLAS" OFF )
+endif( )
+
 if( NOT BUILD_CLIENTS_SAMPLES )
   option( BUILD_CLIENTS_SAMPLES "Build hipBLAS samples" OFF )
 endif( )
@@ -2849,6 +2849,90 @@ void ref_gemm<hipblasBfloat16, float, float>(hipblasOperation_t transA,
                 ldc);
 }
 
+// cblas does not support 8-bit floats, so convert to float, in which the products and sums of
+// the test data are exact
+template <typename Ti>
+static void ref_gemm_f8(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            m,
+                        int64_t            n,
+                        int64_t            k,
+                        float              alpha,
+                        Ti*                A,
+                        int64_t            lda,
+                        Ti*                B,
+                        int64_t            ldb,
+                        float              beta,
+                        float*             C,
+                        int64_t            ldc)
+{
+    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
+    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
+
+    std::unique_ptr<float[]> A_float(new float[sizeA]());
+    std::unique_ptr<float[]> B_float(new float[sizeB]());
+
+    for(size_t i = 0; i < sizeA; i++)
+    {
+        A_float[i] = float(A[i]);
+    }
+    for(size_t i = 0; i < sizeB; i++)
+    {
+        B_float[i] = float(B[i]);
+    }
+
+    cblas_sgemm(CblasColMajor,
+                (CBLAS_TRANSPOSE)transA,
+                (CBLAS_TRANSPOSE)transB,
+                m,
+                n,
+                k,
+                alpha,
+                const_cast<const float*>(A_float.get()),
+                lda,
+                const_cast<const float*>(B_float.get()),
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void ref_gemm<hipblasF8E4M3Fnuz, float, float>(hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               float              alpha,
+                                               hipblasF8E4M3Fnuz* A,
+                                               int64_t            lda,
+                                               hipblasF8E4M3Fnuz* B,
+                                               int64_t            ldb,
+                                               float              beta,
+                                               float*             C,
+                                               int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+void ref_gemm<hipblasF8E5M2Fnuz, float, float>(hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               float              alpha,
+                                               hipblasF8E5M2Fnuz* A,
+                                               int64_t            lda,
+                                               hipblasF8E5M2Fnuz* B,
+                                               int64_t            ldb,
+                                               float              beta,
+                                               float*             C,
+                                               int64_t            ldc)
+{
+    ref_gemm_f8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 void ref_gemm<float>(hipblasOperation_t transA,
                      hipblasOperation_t transB,
@@ -3034,6 +3118,140 @@ void ref_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
         C[i] = static_cast<int32_t>(C_double[i]);
 }
 
+// gemm_quantized
+template <typename To>
+static void ref_gemm_quantized_impl(hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int64_t            m,
+                                    int64_t            n,
+                                    int64_t            k,
+                                    int8_t*            A,
+                                    int64_t            lda,
+                                    int8_t*            B,
+                                    int64_t            ldb,
+                                    const float*       row_scale,
+                                    const float*       col_scale,
+                                    int32_t            zero_point,
+                                    To*                C,
+                                    int64_t            ldc)
+{
+    std::vector<int32_t> product(size_t(m) * n);
+    ref_gemm<int8_t, int32_t, int32_t>(
+        transA, transB, m, n, k, 1, A, lda, B, ldb, 0, product.data(), m);
+
+    // Scaled in the same order as on the device, so the float results match exactly
+    for(int64_t j = 0; j < n; j++)
+    {
+        for(int64_t i = 0; i < m; i++)
+        {
+            float row   = row_scale ? row_scale[i] : 1.0f;
+            float scale = col_scale ? row * col_scale[j] : row;
+            float value = scale * float(product[i + j * m]);
+            if constexpr(std::is_same<To, int8_t>{})
+            {
+                float q        = std::nearbyint(value) + float(zero_point);
+                C[i + j * ldc] = int8_t(std::min(std::max(q, -128.0f), 127.0f));
+            }
+            else
+                C[i + j * ldc] = float_to_half(value);
+        }
+    }
+}
+
+template <>
+void ref_gemm_quantized<int8_t>(hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                int8_t*            A,
+                                int64_t            lda,
+                                int8_t*            B,
+                                int64_t            ldb,
+                                const float*       row_scale,
+                                const float*       col_scale,
+                                int32_t            zero_point,
+                                int8_t*            C,
+                                int64_t            ldc)
+{
+    ref_gemm_quantized_impl(
+        transA, transB, m, n, k, A, lda, B, ldb, row_scale, col_scale, zero_point, C, ldc);
+}
+
+template <>
+void ref_gemm_quantized<hipblasHalf>(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     int64_t            k,
+                                     int8_t*            A,
+                                     int64_t            lda,
+                                     int8_t*            B,
+                                     int64_t            ldb,
+                                     const float*       row_scale,
+                                     const float*       col_scale,
+                                     int32_t            zero_point,
+                                     hipblasHalf*       C,
+                                     int64_t            ldc)
+{
+    ref_gemm_quantized_impl(
+        transA, transB, m, n, k, A, lda, B, ldb, row_scale, col_scale, zero_point, C, ldc);
+}
+
+// gemm_epilogue
+template <typename T>
+static void ref_gemm_epilogue_impl(hipblasGemmActivation_t activation,
+                                   int64_t                 m,
+                                   int64_t                 n,
+                                   const T*                bias,
+                                   const T*                aux,
+                                   int64_t                 ld_aux,
+                                   T*                      C,
+                                   int64_t                 ldc)
+{
+    for(int64_t j = 0; j < n; j++)
+    {
+        for(int64_t i = 0; i < m; i++)
+        {
+            T x = C[i + j * ldc] + (bias ? bias[i] : T(0));
+            if(activation == HIPBLAS_GEMM_ACTIVATION_RELU)
+                x = x > T(0) ? x : T(0);
+            else if(activation == HIPBLAS_GEMM_ACTIVATION_GELU)
+                x = T(0.5) * x
+                    * (T(1) + std::tanh(T(0.7978845608028654) * (x + T(0.044715) * x * x * x)));
+            if(aux)
+                x += aux[i + j * ld_aux];
+            C[i + j * ldc] = x;
+        }
+    }
+}
+
+template <>
+void ref_gemm_epilogue<float>(hipblasGemmActivation_t activation,
+                              int64_t                 m,
+                              int64_t                 n,
+                              const float*            bias,
+                              const float*            aux,
+                              int64_t                 ld_aux,
+                              float*                  C,
+                              int64_t                 ldc)
+{
+    ref_gemm_epilogue_impl(activation, m, n, bias, aux, ld_aux, C, ldc);
+}
+
+template <>
+void ref_gemm_epilogue<double>(hipblasGemmActivation_t activation,
+                               int64_t                 m,
+                               int64_t                 n,
+                               const double*           bias,
+                               const double*           aux,
+                               int64_t                 ld_aux,
+                               double*                 C,
+                               int64_t                 ldc)
+{
+    ref_gemm_epilogue_impl(activation, m, n, bias, aux, ld_aux, C, ldc);
+}
+
 // hemm
 template <>
 void ref_hemm(hipblasSideMode_t side,
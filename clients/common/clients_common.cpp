@@ -207,6 +207,8 @@
 #include "blas_ex/testing_dot_strided_batched_ex.hpp"
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_grouped_batched_ex.hpp"
+#include "blas_ex/testing_gemm_quantized_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_ex.hpp"
@@ -421,6 +423,8 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_strided_batched", testname_gemm_strided_batched},
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
+        {"gemm_grouped_batched_ex", testname_gemm_grouped_batched_ex},
+        {"gemm_quantized_ex", testname_gemm_quantized_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
@@ -512,6 +516,7 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex<Ti, To, Tc>},
+            {"gemm_grouped_batched_ex", testing_gemm_grouped_batched_ex<Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -542,6 +547,31 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+// Template to dispatch testing_gemm_quantized_ex for performance tests
+// Only int8 inputs with an int32 accumulator and an int8 or half output are valid
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_quantized_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_quantized_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, int8_t>{} && std::is_same<Tc, int32_t>{}
+                     && (std::is_same<To, int8_t>{} || std::is_same<To, hipblasHalf>{})>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_quantized_ex", testing_gemm_quantized_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename T, typename U = T, typename = void>
 struct perf_blas : hipblas_test_invalid
 {
@@ -1282,7 +1312,9 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_batched_ex")
+       || !strcmp(function, "gemm_quantized_ex"))
     {
         // adjust dimension for GEMM routines
         int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1310,7 +1342,10 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
             std::cout << "hipblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        hipblas_gemm_dispatch<perf_gemm_ex>(arg);
+        if(!strcmp(function, "gemm_quantized_ex"))
+            hipblas_gemm_quantized_dispatch<perf_gemm_quantized_ex>(arg);
+        else
+            hipblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
     else if(!strcmp(function, "gemm_strided_batched_ex"))
     {
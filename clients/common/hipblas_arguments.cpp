@@ -27,6 +27,8 @@
 #include <cstring>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <utility>
 
 bool gpu_arch_match(const std::string& gpu_arch, const char pattern[4])
@@ -135,3 +137,115 @@ void Arguments::validate(std::istream& ifs)
 #define CHECK_FUNC(NAME) check_func(#NAME, arg.NAME)
     FOR_EACH_ARGUMENT(CHECK_FUNC, ;);
 }
+
+std::string hipblas_parse_bench_line(const std::string& line, Arguments& arg)
+{
+    std::vector<std::string> tokens;
+    std::istringstream       in(line);
+    for(std::string token; in >> token;)
+        tokens.push_back(token);
+
+    std::string precision = "f32_r";
+    std::string a_type, b_type, c_type, d_type, compute_type, compute_type_gemm;
+
+    // tokens[0] is the name of the bench executable
+    for(size_t i = 1; i + 1 < tokens.size(); i += 2)
+    {
+        const std::string& option = tokens[i];
+        const std::string& value  = tokens[i + 1];
+
+        if(option == "-f")
+            snprintf(arg.function, sizeof(arg.function), "%s", value.c_str());
+        else if(option == "-r")
+            precision = value;
+        else if(option == "--a_type")
+            a_type = value;
+        else if(option == "--b_type")
+            b_type = value;
+        else if(option == "--c_type")
+            c_type = value;
+        else if(option == "--d_type")
+            d_type = value;
+        else if(option == "--compute_type")
+            compute_type = value;
+        else if(option == "--compute_type_gemm")
+            compute_type_gemm = value;
+        else if(option == "-m")
+            arg.M = std::stoll(value);
+        else if(option == "-n")
+            arg.N = std::stoll(value);
+        else if(option == "-k")
+            arg.K = std::stoll(value);
+        else if(option == "--kl")
+            arg.KL = std::stoll(value);
+        else if(option == "--ku")
+            arg.KU = std::stoll(value);
+        else if(option == "--lda")
+            arg.lda = std::stoll(value);
+        else if(option == "--ldb")
+            arg.ldb = std::stoll(value);
+        else if(option == "--ldc")
+            arg.ldc = std::stoll(value);
+        else if(option == "--ldd")
+            arg.ldd = std::stoll(value);
+        else if(option == "--stride_a")
+            arg.stride_a = std::stoll(value);
+        else if(option == "--stride_b")
+            arg.stride_b = std::stoll(value);
+        else if(option == "--stride_c")
+            arg.stride_c = std::stoll(value);
+        else if(option == "--stride_d")
+            arg.stride_d = std::stoll(value);
+        else if(option == "--stride_x")
+            arg.stride_x = std::stoll(value);
+        else if(option == "--stride_y")
+            arg.stride_y = std::stoll(value);
+        else if(option == "--stride_alpha")
+            arg.stride_alpha = std::stoll(value);
+        else if(option == "--incx")
+            arg.incx = std::stoll(value);
+        else if(option == "--incy")
+            arg.incy = std::stoll(value);
+        else if(option == "--alpha")
+            arg.alpha = std::stod(value);
+        else if(option == "--alphai")
+            arg.alphai = std::stod(value);
+        else if(option == "--beta")
+            arg.beta = std::stod(value);
+        else if(option == "--betai")
+            arg.betai = std::stod(value);
+        else if(option == "--transposeA")
+            arg.transA = value[0];
+        else if(option == "--transposeB")
+            arg.transB = value[0];
+        else if(option == "--side")
+            arg.side = value[0];
+        else if(option == "--uplo")
+            arg.uplo = value[0];
+        else if(option == "--diag")
+            arg.diag = value[0];
+        else if(option == "--batch_count")
+            arg.batch_count = std::stoll(value);
+        else if(option == "--algo")
+            arg.algo = uint32_t(std::stoul(value));
+        else if(option == "--flags")
+            arg.flags = uint32_t(std::stoul(value));
+        else if(option == "--epilogue")
+            arg.epilogue = uint32_t(std::stoul(value));
+        else if(option == "--api")
+            arg.api = hipblas_client_api(std::stoi(value));
+        else
+            throw std::invalid_argument("Unknown option " + option + " in bench command: " + line);
+    }
+
+    auto prec        = string2hipblas_datatype(precision);
+    arg.a_type       = a_type == "" ? prec : string2hipblas_datatype(a_type);
+    arg.b_type       = b_type == "" ? prec : string2hipblas_datatype(b_type);
+    arg.c_type       = c_type == "" ? prec : string2hipblas_datatype(c_type);
+    arg.d_type       = d_type == "" ? prec : string2hipblas_datatype(d_type);
+    arg.compute_type = compute_type == "" ? prec : string2hipblas_datatype(compute_type);
+    if(compute_type_gemm != "")
+        arg.compute_type_gemm = string2hipblas_computetype(compute_type_gemm);
+
+    return tokens.empty() ? "" : tokens[0];
+}
@@ -184,6 +184,10 @@ hipblasDatatype_t string2hipblas_datatype(const std::string& value)
         value == "u32_r"                 ? HIPBLAS_R_32U  :
         value == "u8_c"                  ? HIPBLAS_C_8U   :
         value == "u32_c"                 ? HIPBLAS_C_32U  :
+#ifdef HIPBLAS_V2
+        value == "f8_fnuz_r"             ? HIP_R_8F_E4M3_FNUZ :
+        value == "bf8_fnuz_r"            ? HIP_R_8F_E5M2_FNUZ :
+#endif
         HIPBLAS_DATATYPE_INVALID;
 }
 
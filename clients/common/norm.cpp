@@ -226,6 +226,27 @@ double norm_check_general<int32_t>(
     return norm_check_general<float>(norm_type, M, N, lda, hCPU_float, hGPU_float);
 }
 
+template <>
+double norm_check_general<int8_t>(
+    char norm_type, int64_t M, int64_t N, int64_t lda, int8_t* hCPU, int8_t* hGPU)
+{
+    // norm type can be 'M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
+
+    host_vector<float> hCPU_float(N * lda);
+    host_vector<float> hGPU_float(N * lda);
+
+    for(int64_t i = 0; i < M; i++)
+    {
+        for(int64_t j = 0; j < N; j++)
+        {
+            hCPU_float[i + j * lda] = (hCPU[i + j * lda]);
+            hGPU_float[i + j * lda] = (hGPU[i + j * lda]);
+        }
+    }
+
+    return norm_check_general<float>(norm_type, M, N, lda, hCPU_float, hGPU_float);
+}
+
 /* ============================Norm Check for Symmetric Matrix: float/double/complex template
  * speciliazation ======================================= */
 
@@ -34,6 +34,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <map>
 #include <stdexcept>
 #include <stdlib.h>
 
@@ -62,6 +63,41 @@ void d_vector_set_pad_length(size_t pad)
     g_DVEC_PAD = pad;
 }
 
+// Device blocks kept by hipblas_client_set_device_cache, by size in bytes
+static bool                          g_hipblas_client_device_cache = false;
+static std::multimap<size_t, void*> g_hipblas_client_device_blocks;
+
+void hipblas_client_set_device_cache(bool enable)
+{
+    g_hipblas_client_device_cache = enable;
+    if(!enable)
+    {
+        for(auto& block : g_hipblas_client_device_blocks)
+            CHECK_HIP_ERROR((hipFree)(block.second));
+        g_hipblas_client_device_blocks.clear();
+    }
+}
+
+void* hipblas_client_device_cache_take(size_t bytes)
+{
+    if(!g_hipblas_client_device_cache)
+        return nullptr;
+    auto block = g_hipblas_client_device_blocks.find(bytes);
+    if(block == g_hipblas_client_device_blocks.end())
+        return nullptr;
+    void* ptr = block->second;
+    g_hipblas_client_device_blocks.erase(block);
+    return ptr;
+}
+
+bool hipblas_client_device_cache_give(void* ptr, size_t bytes)
+{
+    if(!g_hipblas_client_device_cache)
+        return false;
+    g_hipblas_client_device_blocks.emplace(bytes, ptr);
+    return true;
+}
+
 hipblas_rng_t hipblas_rng(69069);
 hipblas_rng_t hipblas_seed(hipblas_rng);
 
@@ -188,6 +224,19 @@ std::string hipblas_tempname()
  * local handles *
  *****************/
 
+static hipStream_t     g_hipblas_client_stream = nullptr;
+static hipblasHandle_t g_hipblas_client_handle = nullptr;
+
+void hipblas_client_set_stream(hipStream_t stream)
+{
+    g_hipblas_client_stream = stream;
+}
+
+void hipblas_client_set_handle(hipblasHandle_t handle)
+{
+    g_hipblas_client_handle = handle;
+}
+
 hipblasLocalHandle::hipblasLocalHandle()
 {
     auto status = hipblasCreate(&m_handle);
@@ -196,8 +245,19 @@ hipblasLocalHandle::hipblasLocalHandle()
 }
 
 hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
-    : hipblasLocalHandle()
 {
+    if(g_hipblas_client_handle)
+    {
+        m_handle = g_hipblas_client_handle;
+        m_owned  = false;
+    }
+    else
+    {
+        auto status = hipblasCreate(&m_handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
     hipblasAtomicsMode_t mode;
     auto                 status = hipblasGetAtomicsMode(m_handle, &mode);
     if(status != HIPBLAS_STATUS_SUCCESS)
@@ -205,6 +265,8 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
 
     if(mode != hipblasAtomicsMode_t(arg.atomics_mode))
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
+    if(status == HIPBLAS_STATUS_SUCCESS && g_hipblas_client_stream)
+        status = hipblasSetStream(m_handle, g_hipblas_client_stream);
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
         /*
@@ -238,6 +300,8 @@ hipblasLocalHandle::~hipblasLocalHandle()
                       << hipGetErrorString(hipStatus) << "\n";
         }
     }
+    if(!m_owned)
+        return;
     hipblasStatus_t status = hipblasDestroy(m_handle);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
@@ -508,6 +572,13 @@ int getArchMajor()
     return static_cast<int>(getArch()) / 100;
 }
 
+bool getArchHasF8()
+{
+    hipblasClientProcessor arch = getArch();
+    return arch == hipblasClientProcessor::gfx940 || arch == hipblasClientProcessor::gfx941
+           || arch == hipblasClientProcessor::gfx942;
+}
+
 #ifdef __cplusplus
 }
 #endif
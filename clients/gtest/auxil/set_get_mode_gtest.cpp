@@ -20,9 +20,15 @@
  *
  * ************************************************************************ */
 
+#include "auxil/testing_get_handle_stats.hpp"
+#include "auxil/testing_bench_log.hpp"
+#include "auxil/testing_graph_capture.hpp"
+#include "auxil/testing_row_major.hpp"
+#include "auxil/testing_handle_pool.hpp"
 #include "auxil/testing_set_get_atomics_mode.hpp"
 #include "auxil/testing_set_get_math_mode.hpp"
 #include "auxil/testing_set_get_pointer_mode.hpp"
+#include "auxil/testing_set_get_workspace.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +41,12 @@ namespace
         SG_POINTER,
         SG_ATOMICS,
         SG_MATH,
+        SG_WORKSPACE,
+        SG_HANDLE_STATS,
+        SG_BENCH_LOG,
+        SG_HANDLE_POOL,
+        SG_GRAPH_CAPTURE,
+        SG_ROW_MAJOR,
     };
 
     // aux test template
@@ -72,6 +84,18 @@ namespace
                 return !strcmp(arg.function, "set_get_atomics_mode");
             case SG_MATH:
                 return !strcmp(arg.function, "set_get_math_mode");
+            case SG_WORKSPACE:
+                return !strcmp(arg.function, "set_get_workspace");
+            case SG_HANDLE_STATS:
+                return !strcmp(arg.function, "get_handle_stats");
+            case SG_BENCH_LOG:
+                return !strcmp(arg.function, "bench_log");
+            case SG_HANDLE_POOL:
+                return !strcmp(arg.function, "handle_pool");
+            case SG_GRAPH_CAPTURE:
+                return !strcmp(arg.function, "graph_capture");
+            case SG_ROW_MAJOR:
+                return !strcmp(arg.function, "row_major");
             }
             return false;
         }
@@ -86,6 +110,18 @@ namespace
                 testname_set_get_atomics_mode(arg, name);
             else if constexpr(AUX_TYPE == SG_MATH)
                 testname_set_get_math_mode(arg, name);
+            else if constexpr(AUX_TYPE == SG_WORKSPACE)
+                testname_set_get_workspace(arg, name);
+            else if constexpr(AUX_TYPE == SG_HANDLE_STATS)
+                testname_get_handle_stats(arg, name);
+            else if constexpr(AUX_TYPE == SG_BENCH_LOG)
+                testname_bench_log(arg, name);
+            else if constexpr(AUX_TYPE == SG_HANDLE_POOL)
+                testname_handle_pool(arg, name);
+            else if constexpr(AUX_TYPE == SG_GRAPH_CAPTURE)
+                testname_graph_capture(arg, name);
+            else if constexpr(AUX_TYPE == SG_ROW_MAJOR)
+                testname_row_major(arg, name);
 
             return std::move(name);
         }
@@ -102,6 +138,18 @@ namespace
                 testing_set_get_atomics_mode(arg);
             else if(!strcmp(arg.function, "set_get_math_mode"))
                 testing_set_get_math_mode(arg);
+            else if(!strcmp(arg.function, "set_get_workspace"))
+                testing_set_get_workspace(arg);
+            else if(!strcmp(arg.function, "get_handle_stats"))
+                testing_get_handle_stats(arg);
+            else if(!strcmp(arg.function, "bench_log"))
+                testing_bench_log(arg);
+            else if(!strcmp(arg.function, "handle_pool"))
+                testing_handle_pool(arg);
+            else if(!strcmp(arg.function, "graph_capture"))
+                testing_graph_capture(arg);
+            else if(!strcmp(arg.function, "row_major"))
+                testing_row_major(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -128,4 +176,46 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_math);
 
+    using set_get_workspace = aux_mode_template<aux_mode_testing, SG_WORKSPACE>;
+    TEST_P(set_get_workspace, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_workspace);
+
+    using get_handle_stats = aux_mode_template<aux_mode_testing, SG_HANDLE_STATS>;
+    TEST_P(get_handle_stats, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(get_handle_stats);
+
+    using bench_log = aux_mode_template<aux_mode_testing, SG_BENCH_LOG>;
+    TEST_P(bench_log, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(bench_log);
+
+    using handle_pool = aux_mode_template<aux_mode_testing, SG_HANDLE_POOL>;
+    TEST_P(handle_pool, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(handle_pool);
+
+    using graph_capture = aux_mode_template<aux_mode_testing, SG_GRAPH_CAPTURE>;
+    TEST_P(graph_capture, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(graph_capture);
+
+    using row_major = aux_mode_template<aux_mode_testing, SG_ROW_MAJOR>;
+    TEST_P(row_major, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(row_major);
+
 } // namespace
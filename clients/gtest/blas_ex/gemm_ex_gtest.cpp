@@ -22,6 +22,8 @@
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_grouped_batched_ex.hpp"
+#include "blas_ex/testing_gemm_quantized_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +37,8 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_GROUPED_BATCHED_EX,
+        GEMM_QUANTIZED_EX,
     };
 
     // gemm test template
@@ -66,7 +70,11 @@ namespace
         // Filter for which types apply to this suite
         static bool type_filter(const Arguments& arg)
         {
-            return hipblas_simple_dispatch<gemm_ex_template::template type_filter_functor>(arg);
+            if constexpr(GEMM_EX_TYPE == GEMM_QUANTIZED_EX)
+                return hipblas_gemm_quantized_dispatch<
+                    gemm_ex_template::template type_filter_functor>(arg);
+            else
+                return hipblas_gemm_dispatch<gemm_ex_template::template type_filter_functor>(arg);
         }
 
         // Filter for which functions apply to this suite
@@ -82,6 +90,11 @@ namespace
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex")
                        || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg");
+            case GEMM_GROUPED_BATCHED_EX:
+                return !strcmp(arg.function, "gemm_grouped_batched_ex");
+            case GEMM_QUANTIZED_EX:
+                return !strcmp(arg.function, "gemm_quantized_ex")
+                       || !strcmp(arg.function, "gemm_quantized_ex_bad_arg");
             }
             return false;
         }
@@ -96,6 +109,10 @@ namespace
                 testname_gemm_batched_ex(arg, name);
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
                 testname_gemm_strided_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_GROUPED_BATCHED_EX)
+                testname_gemm_grouped_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_QUANTIZED_EX)
+                testname_gemm_quantized_ex(arg, name);
             return std::move(name);
         }
     };
@@ -134,6 +151,35 @@ namespace
                 testing_gemm_strided_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex_bad_arg"))
                 testing_gemm_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_batched_ex"))
+                testing_gemm_grouped_batched_ex<Ti, To, Tc>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // The quantized GEMM only takes int8 inputs with an int32 accumulator, and an int8 or
+    // half output
+    template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+    struct gemm_quantized_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename Ti, typename To, typename Tc>
+    struct gemm_quantized_ex_testing<
+        Ti,
+        To,
+        Tc,
+        std::enable_if_t<std::is_same_v<Ti, int8_t> && std::is_same_v<Tc, int32_t>
+                         && (std::is_same_v<To, int8_t> || std::is_same_v<To, hipblasHalf>)>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_quantized_ex"))
+                testing_gemm_quantized_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_quantized_ex_bad_arg"))
+                testing_gemm_quantized_ex_bad_arg<Ti, To, Tc>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -163,4 +209,20 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+    using gemm_grouped_batched_ex = gemm_ex_template<gemm_ex_testing, GEMM_GROUPED_BATCHED_EX>;
+    TEST_P(gemm_grouped_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_batched_ex);
+
+    using gemm_quantized_ex = gemm_ex_template<gemm_quantized_ex_testing, GEMM_QUANTIZED_EX>;
+    TEST_P(gemm_quantized_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_quantized_dispatch<gemm_quantized_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_quantized_ex);
+
 } // namespace
@@ -85,6 +85,14 @@ public:
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
 
+        // Tests from a HIPBLAS_LAYER=profile log carry the number of times the call was made, so
+        // that the time of a mix of calls can be weighted by how often each one runs
+        if(arg.apiCallCount > 1)
+        {
+            name_line << "call_count,hipblas-total-us,";
+            val_line << arg.apiCallCount << ", " << gpu_us / hot_calls * arg.apiCallCount << ", ";
+        }
+
         if(arg.unit_check || arg.norm_check)
         {
             if(arg.norm_check)
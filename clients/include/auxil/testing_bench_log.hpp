@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+#include <fstream>
+
+/* ============================================================================================ */
+
+inline void testname_bench_log(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+// File the library writes its hipblas-bench command lines to, or nullptr when the bench layer
+// is off or logs to stderr
+inline const char* hipblas_client_bench_log_path()
+{
+    const char* layer = getenv("HIPBLAS_LAYER");
+    const char* path  = getenv("HIPBLAS_LOG_BENCH_PATH");
+    if(!layer || !*layer || !path || !*path)
+        return nullptr;
+
+    char*         end  = nullptr;
+    unsigned long mode = strtoul(layer, &end, 0);
+    return (*end ? strstr(layer, "bench") != nullptr : (mode & 0x2) != 0) ? path : nullptr;
+}
+
+// Last command line written to the bench log
+inline std::string hipblas_client_last_bench_line(const char* path)
+{
+    std::ifstream log(path);
+    std::string   line, last;
+    while(std::getline(log, line))
+        if(!line.empty())
+            last = line;
+    return last;
+}
+
+// Each call is logged, the line is parsed back the way hipblas-bench parses its options, and
+// the arguments the benchmark would run with are compared with those of the call
+void testing_bench_log(const Arguments& arg)
+{
+    const char* path = hipblas_client_bench_log_path();
+    if(!path)
+        return;
+
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // Distinct sizes, so an option logged under the wrong name is caught
+    const int64_t M = 5, N = 6, K = 3, KL = 1, KU = 2;
+    const int64_t lda = 11, ldb = 12, ldc = 13, incx = 2, incy = 3;
+    const float   alpha = 2.0f, beta = 3.0f;
+
+    const hipblasComplex calpha(2.0f, 1.0f), cbeta(3.0f, -1.0f);
+
+    device_vector<float>          dA(lda * ldb);
+    device_vector<float>          dB(ldb * ldc);
+    device_vector<float>          dC(ldc * ldc);
+    device_vector<float>          dx(N * incx * incy);
+    device_vector<float>          dy(N * incx * incy);
+    device_vector<hipblasComplex> dCA(lda * ldb);
+    device_vector<hipblasComplex> dCB(ldb * ldc);
+    device_vector<hipblasComplex> dCC(ldc * ldc);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCC.memcheck());
+
+    auto parse = [&](const char* function) {
+        Arguments   logged{};
+        std::string line  = hipblas_client_last_bench_line(path);
+        std::string bench = hipblas_parse_bench_line(line, logged);
+#ifdef HIPBLAS_V2
+        EXPECT_EQ(bench.find("hipblas"), 0u) << line;
+#else
+        EXPECT_EQ(bench, "hipblas-bench") << line;
+#endif
+        EXPECT_STREQ(logged.function, function) << line;
+        return logged;
+    };
+
+    // tbmv runs on arg.M in hipblas-bench
+    CHECK_HIPBLAS_ERROR((hipblasTbmv<float, false>)(handle,
+                                                    HIPBLAS_FILL_MODE_LOWER,
+                                                    HIPBLAS_OP_T,
+                                                    HIPBLAS_DIAG_UNIT,
+                                                    M,
+                                                    K,
+                                                    dA,
+                                                    lda,
+                                                    dx,
+                                                    incx));
+    {
+        Arguments logged = parse("tbmv");
+        EXPECT_EQ(logged.M, M);
+        EXPECT_EQ(logged.K, K);
+        EXPECT_EQ(logged.lda, lda);
+        EXPECT_EQ(logged.incx, incx);
+        EXPECT_EQ(logged.uplo, 'L');
+        EXPECT_EQ(logged.transA, 'T');
+        EXPECT_EQ(logged.diag, 'U');
+    }
+
+    CHECK_HIPBLAS_ERROR((hipblasGbmv<float, false>)(handle,
+                                                    HIPBLAS_OP_N,
+                                                    M,
+                                                    N,
+                                                    KL,
+                                                    KU,
+                                                    &alpha,
+                                                    dA,
+                                                    lda,
+                                                    dx,
+                                                    incx,
+                                                    &beta,
+                                                    dy,
+                                                    incy));
+    {
+        Arguments logged = parse("gbmv");
+        EXPECT_EQ(logged.M, M);
+        EXPECT_EQ(logged.N, N);
+        EXPECT_EQ(logged.KL, KL);
+        EXPECT_EQ(logged.KU, KU);
+        EXPECT_EQ(logged.lda, lda);
+        EXPECT_EQ(logged.incx, incx);
+        EXPECT_EQ(logged.incy, incy);
+        EXPECT_EQ(logged.transA, 'N');
+        EXPECT_EQ(logged.alpha, alpha);
+        EXPECT_EQ(logged.beta, beta);
+    }
+
+    CHECK_HIPBLAS_ERROR((hipblasGemm<float, false>)(handle,
+                                                    HIPBLAS_OP_N,
+                                                    HIPBLAS_OP_T,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    &beta,
+                                                    dC,
+                                                    ldc));
+    {
+        Arguments logged = parse("gemm");
+        EXPECT_EQ(logged.M, M);
+        EXPECT_EQ(logged.N, N);
+        EXPECT_EQ(logged.K, K);
+        EXPECT_EQ(logged.lda, lda);
+        EXPECT_EQ(logged.ldb, ldb);
+        EXPECT_EQ(logged.ldc, ldc);
+        EXPECT_EQ(logged.transA, 'N');
+        EXPECT_EQ(logged.transB, 'T');
+        EXPECT_EQ(logged.alpha, alpha);
+        EXPECT_EQ(logged.beta, beta);
+    }
+
+    // hemm names its sizes n and k in the API, but hipblas-bench runs on arg.M and arg.N
+    CHECK_HIPBLAS_ERROR((hipblasHemm<hipblasComplex, false>)(handle,
+                                                             HIPBLAS_SIDE_RIGHT,
+                                                             HIPBLAS_FILL_MODE_UPPER,
+                                                             M,
+                                                             N,
+                                                             &calpha,
+                                                             dCA,
+                                                             lda,
+                                                             dCB,
+                                                             ldb,
+                                                             &cbeta,
+                                                             dCC,
+                                                             ldc));
+    {
+        Arguments logged = parse("hemm");
+        EXPECT_EQ(logged.M, M);
+        EXPECT_EQ(logged.N, N);
+        EXPECT_EQ(logged.lda, lda);
+        EXPECT_EQ(logged.ldb, ldb);
+        EXPECT_EQ(logged.ldc, ldc);
+        EXPECT_EQ(logged.side, 'R');
+        EXPECT_EQ(logged.uplo, 'U');
+        EXPECT_EQ(logged.alpha, calpha.real());
+        EXPECT_EQ(logged.alphai, calpha.imag());
+        EXPECT_EQ(logged.beta, cbeta.real());
+        EXPECT_EQ(logged.betai, cbeta.imag());
+        EXPECT_EQ(logged.a_type, HIPBLAS_C_32F);
+    }
+}
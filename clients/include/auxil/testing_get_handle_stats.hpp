@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_get_handle_stats(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+// True when the library was started with the stats layer, HIPBLAS_LAYER=stats or 0x20
+inline bool hipblas_client_stats_layer()
+{
+    const char* layer = getenv("HIPBLAS_LAYER");
+    if(!layer || !*layer)
+        return false;
+
+    char*         end  = nullptr;
+    unsigned long mode = strtoul(layer, &end, 0);
+    return *end ? strstr(layer, "stats") != nullptr : (mode & 0x20) != 0;
+}
+
+void testing_get_handle_stats(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    int      count = 0;
+    uint64_t reallocations;
+    EXPECT_HIPBLAS_STATUS(hipblasGetHandleStats(nullptr, nullptr, &count, nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetHandleStats(handle, nullptr, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasResetHandleStats(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    const int            N     = 64;
+    const int            calls = 3;
+    const float          alpha = 1.0f, beta = 0.0f;
+    device_matrix<float> dA(N, N, N);
+    device_matrix<float> dB(N, N, N);
+    device_matrix<float> dC(N, N, N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasResetHandleStats(handle));
+    for(int i = 0; i < calls; i++)
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, dA, N, dB, N, &beta, dC, N));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleStats(handle, nullptr, &count, &reallocations));
+    if(!hipblas_client_stats_layer())
+    {
+        EXPECT_EQ(count, 0);
+        return;
+    }
+    ASSERT_EQ(count, 1);
+
+    hipblasRoutineStats_t stats;
+    count = 1;
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleStats(handle, &stats, &count, nullptr));
+    ASSERT_EQ(count, 1);
+    EXPECT_STREQ(stats.routine, "gemm");
+    EXPECT_STREQ(stats.precision, "f32_r");
+    EXPECT_EQ(stats.calls, uint64_t(calls));
+    EXPECT_GT(stats.hostTimeUs, 0.0);
+    EXPECT_DOUBLE_EQ(stats.gflops, calls * gemm_gflop_count<float>(N, N, N));
+    EXPECT_DOUBLE_EQ(stats.gbytes, calls * gemm_gbyte_count<float>(N, N, N));
+
+    CHECK_HIPBLAS_ERROR(hipblasResetHandleStats(handle));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleStats(handle, nullptr, &count, &reallocations));
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(reallocations, 0u);
+}
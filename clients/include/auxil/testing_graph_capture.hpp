@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_graph_capture(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_graph_capture(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasGraphCaptureMode_t mode;
+    EXPECT_HIPBLAS_STATUS(hipblasSetGraphCaptureMode(nullptr, HIPBLAS_GRAPH_CAPTURE_SAFE),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGraphCaptureMode(handle, hipblasGraphCaptureMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGraphCaptureMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasPrepareForGraphCapture(nullptr, nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    CHECK_HIPBLAS_ERROR(hipblasGetGraphCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_GRAPH_CAPTURE_DEFAULT);
+
+    // Prepare from a function which needs workspace before it ever ran on the handle, run it,
+    // then capture the same call
+    const int          N     = 64;
+    const float        alpha = 1.0f;
+    host_matrix<float> hA(N, N, N);
+    host_matrix<float> hB(N, N, N);
+    host_matrix<float> hB_direct(N, N, N);
+    host_matrix<float> hB_graph(N, N, N);
+
+    device_matrix<float> dA(N, N, N);
+    device_matrix<float> dB(N, N, N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    auto trsm = [&]() {
+        return hipblasStrsm(handle,
+                            HIPBLAS_SIDE_LEFT,
+                            HIPBLAS_FILL_MODE_LOWER,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_DIAG_NON_UNIT,
+                            N,
+                            N,
+                            &alpha,
+                            dA,
+                            N,
+                            dB,
+                            N);
+    };
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // In graph capture safe mode the direct call fails if the prepared memory is too small
+    auto calls = [](hipblasHandle_t, void* trsm_call) {
+        return (*static_cast<decltype(trsm)*>(trsm_call))();
+    };
+    CHECK_HIPBLAS_ERROR(hipblasPrepareForGraphCapture(handle, calls, &trsm, 0));
+    CHECK_HIPBLAS_ERROR(hipblasGetGraphCaptureMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_GRAPH_CAPTURE_SAFE);
+
+    CHECK_HIPBLAS_ERROR(trsm());
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hB_direct.transfer_from(dB));
+
+    hipGraph_t     graph;
+    hipGraphExec_t graph_exec;
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    hipblasStatus_t status = trsm();
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+    // The captured call must give the same answer when the graph is replayed
+    CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hB_graph.transfer_from(dB));
+
+    unit_check_general<float>(N, N, N, hB_direct, hB_graph);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    // cuBLAS has no strided batched trsm; the arrays of pointers it needs instead would be
+    // allocated on the stream, so the call is refused rather than captured
+    EXPECT_HIPBLAS_STATUS(hipblasStrsmStridedBatched(handle,
+                                                     HIPBLAS_SIDE_LEFT,
+                                                     HIPBLAS_FILL_MODE_LOWER,
+                                                     HIPBLAS_OP_N,
+                                                     HIPBLAS_DIAG_NON_UNIT,
+                                                     N,
+                                                     N,
+                                                     &alpha,
+                                                     dA,
+                                                     N,
+                                                     0,
+                                                     dB,
+                                                     N,
+                                                     0,
+                                                     1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+#endif
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIPBLAS_ERROR(hipblasSetGraphCaptureMode(handle, HIPBLAS_GRAPH_CAPTURE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
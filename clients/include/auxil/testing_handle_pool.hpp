@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <set>
+#include <thread>
+
+/* ============================================================================================ */
+
+inline void testname_handle_pool(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_handle_pool(const Arguments& arg)
+{
+    const int           pool_size = 2;
+    hipblasHandlePool_t pool;
+    hipblasHandle_t     handle;
+
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(nullptr, pool_size, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(&pool, 0, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(nullptr, nullptr, &handle),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool, pool_size, 1 << 20));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(pool, nullptr, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A released handle comes back to the same thread, bound to the requested stream
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, stream, &handle));
+    hipStream_t handle_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    EXPECT_EQ(handle_stream, stream);
+
+    // Destroying a pool with a handle checked out is refused
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasHandle_t first = handle;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, nullptr, &handle));
+    EXPECT_EQ(handle, first);
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    EXPECT_EQ(handle_stream, hipStream_t(nullptr));
+
+    // Settings changed by one user are back to those of a new handle for the next
+    hipblasGemmEpilogue_t epilogue{};
+    epilogue.activation = HIPBLAS_GEMM_ACTIVATION_RELU;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSetOrder(handle, HIPBLAS_ORDER_ROW_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmExScales(handle, 2.0f, 4.0f));
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmEpilogue(handle, &epilogue));
+    CHECK_HIPBLAS_ERROR(hipblasSetGraphCaptureMode(handle, HIPBLAS_GRAPH_CAPTURE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, nullptr, &handle));
+    EXPECT_EQ(handle, first);
+
+    hipblasPointerMode_t      pointer_mode;
+    hipblasOrder_t            order;
+    float                     scale_a, scale_b;
+    hipblasGraphCaptureMode_t capture_mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &pointer_mode));
+    CHECK_HIPBLAS_ERROR(hipblasGetOrder(handle, &order));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmExScales(handle, &scale_a, &scale_b));
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmEpilogue(handle, &epilogue));
+    CHECK_HIPBLAS_ERROR(hipblasGetGraphCaptureMode(handle, &capture_mode));
+    EXPECT_EQ(pointer_mode, HIPBLAS_POINTER_MODE_HOST);
+    EXPECT_EQ(order, HIPBLAS_ORDER_COLUMN_MAJOR);
+    EXPECT_EQ(scale_a, 1.0f);
+    EXPECT_EQ(scale_b, 1.0f);
+    EXPECT_EQ(epilogue.activation, HIPBLAS_GEMM_ACTIVATION_NONE);
+    EXPECT_EQ(capture_mode, HIPBLAS_GRAPH_CAPTURE_DEFAULT);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+
+    // Releasing a handle twice, or one that is not from the pool, is refused and leaves the
+    // pool able to be destroyed
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, handle), HIPBLAS_STATUS_INVALID_VALUE);
+    hipblasHandle_t foreign;
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&foreign));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, foreign), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(foreign));
+
+    // More checkouts than pooled handles get extra handles, all distinct
+    std::vector<hipblasHandle_t> handles(pool_size + 2);
+    for(auto& h : handles)
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, nullptr, &h));
+    EXPECT_EQ(std::set<hipblasHandle_t>(handles.begin(), handles.end()).size(), handles.size());
+    for(auto& h : handles)
+        CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, h));
+
+    // Threads checking handles in and out concurrently never share one, and every call runs.
+    // Each thread doubles its own part of x once per checkout.
+    const int                 N       = 16;
+    const int                 threads = 4;
+    const int                 iters   = 100;
+    const float               alpha   = 2.0f;
+    host_vector<float>        hx(N * threads);
+    device_vector<float>      dx(N * threads);
+    std::mutex                held_mutex;
+    std::set<hipblasHandle_t> held;
+    std::atomic<int>          failures{0}, shared{0};
+    std::vector<std::thread>  workers;
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    std::fill(hx.begin(), hx.end(), 1.0f);
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    for(int t = 0; t < threads; t++)
+        workers.emplace_back([&, t] {
+            for(int i = 0; i < iters; i++)
+            {
+                hipblasHandle_t h;
+                if(hipblasHandlePoolAcquire(pool, nullptr, &h) != HIPBLAS_STATUS_SUCCESS)
+                {
+                    failures++;
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(held_mutex);
+                    if(!held.insert(h).second)
+                        shared++;
+                }
+                if(hipblasSscal(h, N, &alpha, (float*)dx + t * N, 1) != HIPBLAS_STATUS_SUCCESS
+                   || hipStreamSynchronize(nullptr) != hipSuccess)
+                    failures++;
+                {
+                    std::lock_guard<std::mutex> lock(held_mutex);
+                    held.erase(h);
+                }
+                if(hipblasHandlePoolRelease(pool, h) != HIPBLAS_STATUS_SUCCESS)
+                    failures++;
+            }
+        });
+    for(auto& worker : workers)
+        worker.join();
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(shared, 0);
+
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    for(int i = 0; i < N * threads; i++)
+        EXPECT_EQ(hx[i], std::ldexp(1.0f, iters));
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,251 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_row_major(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_row_major(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasOrder_t order;
+    EXPECT_HIPBLAS_STATUS(hipblasSetOrder(nullptr, HIPBLAS_ORDER_ROW_MAJOR),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetOrder(handle, hipblasOrder_t(2)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetOrder(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasGetOrder(handle, &order));
+    EXPECT_EQ(order, HIPBLAS_ORDER_COLUMN_MAJOR);
+
+    // A row-major rows x cols matrix with leading dimension ld is stored like a column-major
+    // cols x rows matrix, so the host matrices below are declared transposed. The leading
+    // dimensions are padded to catch a swapped m and n.
+    const int   M = 5, N = 7, K = 3;
+    const int   lda = K + 1, ldb = K + 2, lds = N + 1, ldt = M + 2, ldc = N + 3;
+    const float alpha = 2.0f, beta = 0.0f;
+
+    host_matrix<float> hA(K, M, lda); // M x K
+    host_matrix<float> hB(K, N, ldb); // N x K
+    host_matrix<float> hS(N, N, lds); // N x N symmetric, lower triangle read
+    host_matrix<float> hT(M, M, ldt); // M x M upper triangular
+    host_matrix<float> hX(K, 1, K);
+    host_matrix<float> hC(N, M, ldc); // M x N
+    host_matrix<float> hC_gold(N, M, ldc);
+    host_matrix<float> hY(M, 1, M);
+    host_matrix<float> hY_gold(M, 1, M);
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hS, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hT, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hX, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    for(int i = 0; i < M; i++)
+        hT[0][i * ldt + i] += 10.0f * M;
+
+    device_matrix<float> dA(K, M, lda);
+    device_matrix<float> dB(K, N, ldb);
+    device_matrix<float> dS(N, N, lds);
+    device_matrix<float> dT(M, M, ldt);
+    device_matrix<float> dX(K, 1, K);
+    device_matrix<float> dC(N, M, ldc);
+    device_matrix<float> dY(M, 1, M);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dS.memcheck());
+    CHECK_DEVICE_ALLOCATION(dT.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dY.memcheck());
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dS.transfer_from(hS));
+    CHECK_HIP_ERROR(dT.transfer_from(hT));
+    CHECK_HIP_ERROR(dX.transfer_from(hX));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetOrder(handle, HIPBLAS_ORDER_ROW_MAJOR));
+    CHECK_HIPBLAS_ERROR(hipblasGetOrder(handle, &order));
+    EXPECT_EQ(order, HIPBLAS_ORDER_ROW_MAJOR);
+
+    // The reference results are integers small enough to be exact in float
+    auto A = [&](int i, int j) { return hA[0][i * lda + j]; };
+    auto B = [&](int i, int j) { return hB[0][i * ldb + j]; };
+    auto S = [&](int i, int j) { return i >= j ? hS[0][i * lds + j] : hS[0][j * lds + i]; };
+    auto T = [&](int i, int j) { return i <= j ? hT[0][i * ldt + j] : 0.0f; };
+
+    // gemm: C = alpha * A * B^T
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_T, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    for(int i = 0; i < M; i++)
+        for(int j = 0; j < N; j++)
+        {
+            float sum = 0.0f;
+            for(int k = 0; k < K; k++)
+                sum += A(i, k) * B(j, k);
+            hC_gold[0][i * ldc + j] = alpha * sum;
+        }
+    unit_check_general<float>(N, M, ldc, hC_gold, hC);
+
+    // gemv: y = alpha * A * x
+    CHECK_HIPBLAS_ERROR(
+        hipblasSgemv(handle, HIPBLAS_OP_N, M, K, &alpha, dA, lda, dX, 1, &beta, dY, 1));
+    CHECK_HIP_ERROR(hY.transfer_from(dY));
+    for(int i = 0; i < M; i++)
+    {
+        float sum = 0.0f;
+        for(int k = 0; k < K; k++)
+            sum += A(i, k) * hX[0][k];
+        hY_gold[0][i] = alpha * sum;
+    }
+    unit_check_general<float>(M, 1, M, hY_gold, hY);
+
+    // symm: C = alpha * (A * B^T) * S, reusing the gemm result as the general operand
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    host_matrix<float> hG(N, M, ldc);
+    for(int i = 0; i < M; i++)
+        for(int j = 0; j < N; j++)
+            hG[0][i * ldc + j] = hC[0][i * ldc + j];
+    device_matrix<float> dG(N, M, ldc);
+    CHECK_DEVICE_ALLOCATION(dG.memcheck());
+    CHECK_HIP_ERROR(dG.transfer_from(hG));
+    CHECK_HIPBLAS_ERROR(hipblasSsymm(handle,
+                                     HIPBLAS_SIDE_RIGHT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dS,
+                                     lds,
+                                     dG,
+                                     ldc,
+                                     &beta,
+                                     dC,
+                                     ldc));
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    for(int i = 0; i < M; i++)
+        for(int j = 0; j < N; j++)
+        {
+            float sum = 0.0f;
+            for(int k = 0; k < N; k++)
+                sum += hG[0][i * ldc + k] * S(k, j);
+            hC_gold[0][i * ldc + j] = alpha * sum;
+        }
+    unit_check_general<float>(N, M, ldc, hC_gold, hC);
+
+    // trsm: solve T * X = alpha * G in place, then check T * X against alpha * G
+    CHECK_HIP_ERROR(dC.transfer_from(hG));
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_UPPER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_NON_UNIT,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dT,
+                                     ldt,
+                                     dC,
+                                     ldc));
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    for(int i = 0; i < M; i++)
+        for(int j = 0; j < N; j++)
+        {
+            double sum = 0.0;
+            for(int k = 0; k < M; k++)
+                sum += double(T(i, k)) * hC[0][k * ldc + j];
+            hC_gold[0][i * ldc + j] = float(sum);
+            hG[0][i * ldc + j] *= alpha;
+        }
+    near_check_general<float>(N, M, ldc, hG, hC_gold, 1e-3 * M * N);
+
+    // Level 1 functions have no order, including the strided-batched axpy and dot the cuBLAS
+    // backend queues as GEMMs: y_b += alpha * x_b, then r_b = x_b . y_b in device pointer mode
+    const int           L = 9, batch = 3, incx = 2;
+    const hipblasStride stride_x = L * incx, stride_y = L + 1;
+    host_matrix<float>  hx(stride_x, batch, stride_x);
+    host_matrix<float>  hy(stride_y, batch, stride_y);
+    host_matrix<float>  hy_gold(stride_y, batch, stride_y);
+    host_matrix<float>  hr(1, batch, 1);
+    host_matrix<float>  hr_gold(1, batch, 1);
+    hipblas_init_matrix(hx, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hy, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    device_matrix<float> dx(stride_x, batch, stride_x);
+    device_matrix<float> dy(stride_y, batch, stride_y);
+    device_matrix<float> dr(1, batch, 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dr.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    for(int b = 0; b < batch; b++)
+    {
+        float dot = 0.0f;
+        for(int i = 0; i < stride_y; i++)
+        {
+            hy_gold[0][b * stride_y + i] = hy[0][b * stride_y + i];
+            if(i < L)
+            {
+                hy_gold[0][b * stride_y + i] += alpha * hx[0][b * stride_x + i * incx];
+                dot += hx[0][b * stride_x + i * incx] * hy_gold[0][b * stride_y + i];
+            }
+        }
+        hr_gold[0][b] = dot;
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSaxpyStridedBatched(
+        handle, L, &alpha, dx, incx, stride_x, dy, 1, stride_y, batch));
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    unit_check_general<float>(stride_y, batch, stride_y, hy_gold, hy);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSdotStridedBatched(handle, L, dx, incx, stride_x, dy, 1, stride_y, batch, dr));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIP_ERROR(hr.transfer_from(dr));
+    unit_check_general<float>(1, batch, 1, hr_gold, hr);
+
+    // Calls needing conjugated vectors in row-major order are rejected before the backend
+    EXPECT_HIPBLAS_STATUS(hipblasChemv(handle,
+                                       HIPBLAS_FILL_MODE_UPPER,
+                                       0,
+                                       nullptr,
+                                       nullptr,
+                                       0,
+                                       nullptr,
+                                       1,
+                                       nullptr,
+                                       nullptr,
+                                       1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetOrder(handle, HIPBLAS_ORDER_COLUMN_MAJOR));
+}
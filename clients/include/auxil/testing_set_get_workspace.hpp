@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+void testing_set_get_workspace(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    size_t size = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(nullptr, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasQueryWorkspaceSize(handle, nullptr, nullptr, &size),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Run a function which needs workspace, then hand the handle a buffer of the size it reports
+    const int          N     = 64;
+    const float        alpha = 1.0f;
+    host_matrix<float> hA(N, N, N);
+    host_matrix<float> hB(N, N, N);
+    host_matrix<float> hB_managed(N, N, N);
+    host_matrix<float> hB_workspace(N, N, N);
+    host_matrix<float> hB_query(N, N, N);
+
+    device_matrix<float> dA(N, N, N);
+    device_matrix<float> dB(N, N, N);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    auto trsm = [&]() {
+        return hipblasStrsm(handle,
+                            HIPBLAS_SIDE_LEFT,
+                            HIPBLAS_FILL_MODE_LOWER,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_DIAG_NON_UNIT,
+                            N,
+                            N,
+                            &alpha,
+                            dA,
+                            N,
+                            dB,
+                            N);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // Size the workspace of the call before it ever ran on the handle; the query must not run it
+    auto calls = [](hipblasHandle_t, void* trsm_call) {
+        return (*static_cast<decltype(trsm)*>(trsm_call))();
+    };
+    size_t          query_size   = 0;
+    hipblasStatus_t query_status = hipblasQueryWorkspaceSize(handle, calls, &trsm, &query_size);
+#ifdef __HIP_PLATFORM_NVCC__
+    // cuBLAS does not report the workspace its functions need
+    EXPECT_HIPBLAS_STATUS(query_status, HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    CHECK_HIPBLAS_ERROR(query_status);
+    CHECK_HIP_ERROR(hB_query.transfer_from(dB));
+    unit_check_general<float>(N, N, N, hB, hB_query);
+#endif
+
+    CHECK_HIPBLAS_ERROR(trsm());
+    CHECK_HIP_ERROR(hB_managed.transfer_from(dB));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+
+    device_vector<char> workspace(std::max(size, size_t(1)));
+    CHECK_DEVICE_ALLOCATION(workspace.memcheck());
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, size));
+
+    // The same call must now run out of the provided buffer and give the same answer
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIPBLAS_ERROR(trsm());
+    CHECK_HIP_ERROR(hB_workspace.transfer_from(dB));
+
+    unit_check_general<float>(N, N, N, hB_managed, hB_workspace);
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // A buffer of the queried size must be enough for the call
+    device_vector<char> query_workspace(std::max(query_size, size_t(1)));
+    CHECK_DEVICE_ALLOCATION(query_workspace.memcheck());
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, query_workspace, query_size));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIPBLAS_ERROR(trsm());
+    CHECK_HIP_ERROR(hB_query.transfer_from(dB));
+
+    unit_check_general<float>(N, N, N, hB_managed, hB_query);
+#endif
+
+    // Return to library-managed memory
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+}
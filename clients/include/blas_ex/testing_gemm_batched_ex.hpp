@@ -47,6 +47,7 @@ using hipblasGemmBatchedExModel = ArgumentModel<e_a_type,
                                                 e_beta,
                                                 e_ldc,
                                                 e_batch_count,
+                                                e_stride_alpha,
                                                 e_with_flags,
                                                 e_flags>;
 
@@ -292,6 +293,29 @@ void testing_gemm_batched_ex_bad_arg(const Arguments& arg)
                                           computeType,
                                           algo, flags));
 
+        // Per-instance scalars
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasGemmBatchedExWithScalarStride, (nullptr, transA, transB, M, N, K, alpha, 1,
+                           (const void**)dA.ptr_on_device(), aType, lda,
+                           (const void**)dB.ptr_on_device(), bType, ldb, beta, 1,
+                           (void**)dC.ptr_on_device(), cType, ldc, batch_count,
+                           computeType,
+                           algo));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasGemmBatchedExWithScalarStride, (handle, transA, transB, M, N, K, alpha, -1,
+                           (const void**)dA.ptr_on_device(), aType, lda,
+                           (const void**)dB.ptr_on_device(), bType, ldb, beta, 0,
+                           (void**)dC.ptr_on_device(), cType, ldc, batch_count,
+                           computeType,
+                           algo));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasGemmBatchedExWithScalarStride, (handle, transA, transB, M, N, K, alpha, 0,
+                           (const void**)dA.ptr_on_device(), aType, lda,
+                           (const void**)dB.ptr_on_device(), bType, ldb, beta, -1,
+                           (void**)dC.ptr_on_device(), cType, ldc, batch_count,
+                           computeType,
+                           algo));
+
         // clang-format on
     }
 }
@@ -349,6 +373,12 @@ void testing_gemm_batched_ex(const Arguments& arg)
 
     hipblasLocalHandle handle(arg);
 
+    if constexpr(hipblas_is_f8<Ti>)
+    {
+        if(!getArchHasF8())
+            return;
+    }
+
     // check here to prevent undefined memory allocation error
     bool invalid_size
         = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
@@ -380,6 +410,11 @@ void testing_gemm_batched_ex(const Arguments& arg)
         return;
     }
 
+    // With stride_alpha each instance has its own alpha and beta. They change every second
+    // instance, so that runs of instances sharing host scalars are exercised too
+    hipblasStride stride_alpha = arg.stride_alpha;
+    int64_t       scalar_count = stride_alpha ? (batch_count - 1) * stride_alpha + 1 : 1;
+
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
     // Allocate host memory
     host_batch_matrix<Ti> hA(A_row, A_col, lda, batch_count);
@@ -387,6 +422,8 @@ void testing_gemm_batched_ex(const Arguments& arg)
     host_batch_matrix<To> hC_host(M, N, ldc, batch_count);
     host_batch_matrix<To> hC_device(M, N, ldc, batch_count);
     host_batch_matrix<To> hC_gold(M, N, ldc, batch_count);
+    host_vector<Tex>      h_alpha(scalar_count);
+    host_vector<Tex>      h_beta(scalar_count);
 
     // Check host memory allocation
     CHECK_HIP_ERROR(hA.memcheck());
@@ -399,8 +436,8 @@ void testing_gemm_batched_ex(const Arguments& arg)
     device_batch_matrix<Ti> dA(A_row, A_col, lda, batch_count);
     device_batch_matrix<Ti> dB(B_row, B_col, ldb, batch_count);
     device_batch_matrix<To> dC(M, N, ldc, batch_count);
-    device_vector<Tex>      d_alpha(1);
-    device_vector<Tex>      d_beta(1);
+    device_vector<Tex>      d_alpha(scalar_count);
+    device_vector<Tex>      d_beta(scalar_count);
 
     // Check device memory allocation
     CHECK_DEVICE_ALLOCATION(dA.memcheck());
@@ -420,18 +457,60 @@ void testing_gemm_batched_ex(const Arguments& arg)
     hC_device.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
 
+    const double scalar_factor[] = {1.0, -1.0, 0.5};
+    for(int64_t b = 0; b < (stride_alpha ? batch_count : 1); b++)
+    {
+        double alpha_factor = scalar_factor[(b / 2) % 3];
+        double beta_factor  = (b / 2) % 2 ? 0.0 : 1.0;
+
+        h_alpha[b * stride_alpha]
+            = hipblas_isnan(arg.alpha)
+                  ? h_alpha_Tex
+                  : convert_alpha_beta<Tex>(arg.alpha * alpha_factor, arg.alphai * alpha_factor);
+        h_beta[b * stride_alpha]
+            = hipblas_isnan(arg.beta)
+                  ? h_beta_Tex
+                  : convert_alpha_beta<Tex>(arg.beta * beta_factor, arg.betai * beta_factor);
+    }
+
     // Initial Data on CPU
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB));
     CHECK_HIP_ERROR(dC.transfer_from(hC_host));
-    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
 
     if(unit_check || norm_check)
     {
         // hipBLAS
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        if(!arg.with_flags)
+        if(stride_alpha)
+        {
+            DAPI_CHECK(hipblasGemmBatchedExWithScalarStride,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha.data(),
+                        stride_alpha,
+                        (const void**)(Ti**)dA.ptr_on_device(),
+                        a_type,
+                        lda,
+                        (const void**)(Ti**)dB.ptr_on_device(),
+                        b_type,
+                        ldb,
+                        h_beta.data(),
+                        stride_alpha,
+                        (void**)(To**)dC.ptr_on_device(),
+                        c_type,
+                        ldc,
+                        batch_count,
+                        compute_type,
+                        algo));
+        }
+        else if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmBatchedExFn,
                        (handle,
@@ -485,7 +564,33 @@ void testing_gemm_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(dC.transfer_from(hC_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        if(!arg.with_flags)
+        if(stride_alpha)
+        {
+            DAPI_CHECK(hipblasGemmBatchedExWithScalarStride,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        d_alpha,
+                        stride_alpha,
+                        (const void**)(Ti**)dA.ptr_on_device(),
+                        a_type,
+                        lda,
+                        (const void**)(Ti**)dB.ptr_on_device(),
+                        b_type,
+                        ldb,
+                        d_beta,
+                        stride_alpha,
+                        (void**)(To**)dC.ptr_on_device(),
+                        c_type,
+                        ldc,
+                        batch_count,
+                        compute_type,
+                        algo));
+        }
+        else if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmBatchedExFn,
                        (handle,
@@ -545,12 +650,12 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                   M,
                                   N,
                                   K,
-                                  h_alpha_Tex,
+                                  h_alpha[b * stride_alpha],
                                   hA[b],
                                   lda,
                                   hB[b],
                                   ldb,
-                                  h_beta_Tex,
+                                  h_beta[b * stride_alpha],
                                   hC_gold[b],
                                   ldc);
         }
@@ -595,7 +700,33 @@ void testing_gemm_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            if(!arg.with_flags)
+            if(stride_alpha)
+            {
+                DAPI_DISPATCH(hipblasGemmBatchedExWithScalarStride,
+                              (handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               h_alpha.data(),
+                               stride_alpha,
+                               (const void**)(Ti**)dA.ptr_on_device(),
+                               a_type,
+                               lda,
+                               (const void**)(Ti**)dB.ptr_on_device(),
+                               b_type,
+                               ldb,
+                               h_beta.data(),
+                               stride_alpha,
+                               (void**)(To**)dC.ptr_on_device(),
+                               c_type,
+                               ldc,
+                               batch_count,
+                               compute_type,
+                               algo));
+            }
+            else if(!arg.with_flags)
             {
                 DAPI_DISPATCH(hipblasGemmBatchedExFn,
                               (handle,
@@ -285,6 +285,61 @@ void testing_gemm_ex_bad_arg(const Arguments& arg)
 
         // clang-format on
     }
+
+#ifdef HIPBLAS_V2
+    // The epilogue is checked when it is set, and against C by the calls which apply it
+    auto hipblasGemmExEpilogueFn    = hipblasGemmEx;
+    auto hipblasGemmExEpilogueFn_64 = hipblasGemmEx_64;
+
+    hipblasGemmEpilogue_t epilogue{};
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmEpilogue(nullptr, &epilogue),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetGemmEpilogue(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    epilogue.activation = hipblasGemmActivation_t(3);
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmEpilogue(handle, &epilogue), HIPBLAS_STATUS_INVALID_VALUE);
+    epilogue.activation = HIPBLAS_GEMM_ACTIVATION_RELU;
+    epilogue.strideAux  = -1;
+    EXPECT_HIPBLAS_STATUS(hipblasSetGemmEpilogue(handle, &epilogue), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Complex C takes no epilogue; a real C needs ldAux >= M
+    epilogue.strideAux = 0;
+    epilogue.aux       = dC;
+    epilogue.ldAux     = M - 1;
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmEpilogue(handle, &epilogue));
+
+    // Checked with the other arguments, which cuBLAS does not check in full
+    if(arg.bad_arg_all)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        DAPI_EXPECT(is_complex<To> ? HIPBLAS_STATUS_NOT_SUPPORTED : HIPBLAS_STATUS_INVALID_VALUE,
+                    hipblasGemmExEpilogueFn,
+                    (handle,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     &h_alpha,
+                     dA,
+                     aType,
+                     lda,
+                     dB,
+                     bType,
+                     ldb,
+                     &h_beta,
+                     dC,
+                     cType,
+                     ldc,
+                     computeType,
+                     algo));
+    }
+
+    hipblasGemmEpilogue_t epilogue_set;
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmEpilogue(handle, &epilogue_set));
+    unit_check_general<int64_t>(1, 1, 1, &epilogue.ldAux, &epilogue_set.ldAux);
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmEpilogue(handle, nullptr));
+#endif
 }
 
 template <typename Ti, typename To = Ti, typename Tex = To>
@@ -334,6 +389,22 @@ void testing_gemm_ex(const Arguments& arg)
 
     hipblasLocalHandle handle(arg);
 
+    if constexpr(hipblas_is_f8<Ti>)
+    {
+        if(!getArchHasF8())
+            return;
+    }
+
+    // The epilogue applies to the HIPBLAS_V2 form of hipblasGemmEx, with a real C
+    constexpr bool epilogue_type = std::is_same_v<To, float> || std::is_same_v<To, double>;
+#ifdef HIPBLAS_V2
+    if(arg.epilogue && (!epilogue_type || arg.with_flags))
+        return;
+#else
+    if(arg.epilogue)
+        return;
+#endif
+
     // check here to prevent undefined memory allocation error
     bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
     if(invalid_size || !M || !N)
@@ -377,6 +448,14 @@ void testing_gemm_ex(const Arguments& arg)
     device_vector<Tex> d_alpha(1);
     device_vector<Tex> d_beta(1);
 
+    // Epilogue operands, packed with leading dimension M
+    const bool        epilogue_bias = arg.epilogue & 1;
+    const bool        epilogue_aux  = arg.epilogue & 8;
+    host_vector<To>   h_bias(epilogue_bias ? M : 1);
+    host_vector<To>   h_aux(epilogue_aux ? M * N : 1);
+    device_vector<To> d_bias(epilogue_bias ? M : 1);
+    device_vector<To> d_aux(epilogue_aux ? M * N : 1);
+
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
     // Initial Data on CPU
@@ -387,6 +466,21 @@ void testing_gemm_ex(const Arguments& arg)
 
     hC_gold = hC_device = hC_host;
 
+    if(arg.epilogue)
+    {
+        hipblas_init_vector(h_bias, arg, hipblas_client_never_set_nan, false, true);
+        hipblas_init_vector(h_aux, arg, hipblas_client_never_set_nan);
+        CHECK_HIP_ERROR(d_bias.transfer_from(h_bias));
+        CHECK_HIP_ERROR(d_aux.transfer_from(h_aux));
+
+        hipblasGemmEpilogue_t epilogue{};
+        epilogue.activation = arg.get_epilogue_activation();
+        epilogue.bias       = epilogue_bias ? (To*)d_bias : nullptr;
+        epilogue.aux        = epilogue_aux ? (To*)d_aux : nullptr;
+        epilogue.ldAux      = M;
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmEpilogue(handle, &epilogue));
+    }
+
     // copy data from CPU to device
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
@@ -399,6 +493,16 @@ void testing_gemm_ex(const Arguments& arg)
     {
         // hipBLAS
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // The host pointer mode call also checks the scale factors of 8-bit float inputs: A
+        // scaled by 2 with alpha halved gives the same result
+        Tex h_alpha_host = h_alpha_Tex;
+        if constexpr(hipblas_is_f8<Ti>)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetGemmExScales(handle, 2.0f, 1.0f));
+            h_alpha_host = h_alpha_Tex / 2;
+        }
+
         if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmExFn,
@@ -408,7 +512,7 @@ void testing_gemm_ex(const Arguments& arg)
                         M,
                         N,
                         K,
-                        &h_alpha_Tex,
+                        &h_alpha_host,
                         dA,
                         a_type,
                         lda,
@@ -431,7 +535,7 @@ void testing_gemm_ex(const Arguments& arg)
                         M,
                         N,
                         K,
-                        &h_alpha_Tex,
+                        &h_alpha_host,
                         dA,
                         a_type,
                         lda,
@@ -450,6 +554,10 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_host.transfer_from(dC));
         CHECK_HIP_ERROR(dC.transfer_from(hC_device));
 
+        // Scale factors other than 1 need alpha on the host with rocBLAS
+        if constexpr(hipblas_is_f8<Ti>)
+            CHECK_HIPBLAS_ERROR(hipblasSetGemmExScales(handle, 1.0f, 1.0f));
+
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         if(!arg.with_flags)
         {
@@ -516,13 +624,44 @@ void testing_gemm_ex(const Arguments& arg)
                               hC_gold.data(),
                               ldc);
 
+        if constexpr(epilogue_type)
+        {
+            if(arg.epilogue)
+                ref_gemm_epilogue<To>(arg.get_epilogue_activation(),
+                                      M,
+                                      N,
+                                      epilogue_bias ? h_bias.data() : nullptr,
+                                      epilogue_aux ? h_aux.data() : nullptr,
+                                      M,
+                                      hC_gold.data(),
+                                      ldc);
+        }
+
+        // GELU goes through tanh, which the device may round differently from the host
+        double gelu_tol = 0;
+        if constexpr(epilogue_type)
+        {
+            if(arg.epilogue && arg.get_epilogue_activation() == HIPBLAS_GEMM_ACTIVATION_GELU)
+            {
+                for(int64_t j = 0; j < N; j++)
+                    for(int64_t i = 0; i < M; i++)
+                        gelu_tol = std::max(gelu_tol, double(hipblas_abs(hC_gold[0][i + j * ldc])));
+                gelu_tol *= 8 * std::numeric_limits<To>::epsilon();
+            }
+        }
+
         if(unit_check)
         {
+            if(gelu_tol > 0)
+            {
+                near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), gelu_tol);
+                near_check_general<To>(M, N, ldc, hC_gold.data(), hC_device.data(), gelu_tol);
+            }
             // check for float16/bfloat16 input
-            if((getArchMajor() == 11)
-               && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
-                   || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
-                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+            else if((getArchMajor() == 11)
+                    && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                        || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                        || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
             {
                 const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
                 near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
@@ -541,6 +680,36 @@ void testing_gemm_ex(const Arguments& arg)
             hipblas_error_device
                 = hipblas_abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_device));
         }
+
+        // The epilogue is left set: the GEMM the cuBLAS backend queues to emulate a
+        // strided-batched axpy is its own and must not apply it
+        if constexpr(epilogue_type)
+        {
+            if(arg.epilogue && unit_check)
+            {
+                const int       n = 4, batch = 2;
+                const To        one(1);
+                host_matrix<To> hx(n, batch, n), hy(n, batch, n), hy_gold(n, batch, n);
+                for(int i = 0; i < n * batch; i++)
+                {
+                    hx[0][i]      = To(-1 - i);
+                    hy[0][i]      = To(0);
+                    hy_gold[0][i] = hx[0][i];
+                }
+
+                device_matrix<To> dx(n, batch, n), dy(n, batch, n);
+                CHECK_DEVICE_ALLOCATION(dx.memcheck());
+                CHECK_DEVICE_ALLOCATION(dy.memcheck());
+                CHECK_HIP_ERROR(dx.transfer_from(hx));
+                CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+                CHECK_HIPBLAS_ERROR(
+                    hipblasAxpyStridedBatched<To>(handle, n, &one, dx, 1, n, dy, 1, n, batch));
+                CHECK_HIP_ERROR(hy.transfer_from(dy));
+                unit_check_general<To>(n, batch, n, hy_gold, hy);
+            }
+        }
     }
 
     if(timing)
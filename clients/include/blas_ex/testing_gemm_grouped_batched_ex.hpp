@@ -0,0 +1,414 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedExModel = ArgumentModel<e_a_type,
+                                                       e_c_type,
+                                                       e_compute_type,
+                                                       e_transA,
+                                                       e_transB,
+                                                       e_M,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_ldb,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_batch_count>;
+
+inline void testname_gemm_grouped_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedExModel{}.test_name(arg, name);
+}
+
+// Sizes and operations of one group of a grouped GEMM
+struct gemm_group_sizes
+{
+    hipblasOperation_t transA;
+    hipblasOperation_t transB;
+    int64_t            M;
+    int64_t            N;
+    int64_t            K;
+    int64_t            lda;
+    int64_t            ldb;
+    int64_t            ldc;
+    int64_t            group_size;
+
+    int64_t A_row() const
+    {
+        return transA == HIPBLAS_OP_N ? M : K;
+    }
+    int64_t A_col() const
+    {
+        return transA == HIPBLAS_OP_N ? K : M;
+    }
+    int64_t B_row() const
+    {
+        return transB == HIPBLAS_OP_N ? K : N;
+    }
+    int64_t B_col() const
+    {
+        return transB == HIPBLAS_OP_N ? N : K;
+    }
+};
+
+// Calls the 32-bit or the 64-bit grouped GEMM with the groups converted to arrays of I
+template <typename I, typename Tex, typename Tc>
+hipblasStatus_t gemm_grouped_batched_ex_call(hipblasHandle_t                      handle,
+                                             const std::vector<gemm_group_sizes>& groups,
+                                             const Tex*                           alpha,
+                                             const void* const                    A[],
+                                             hipblasDatatype_t                    a_type,
+                                             const void* const                    B[],
+                                             hipblasDatatype_t                    b_type,
+                                             const Tex*                           beta,
+                                             void* const                          C[],
+                                             hipblasDatatype_t                    c_type,
+                                             Tc                                   compute_type)
+{
+    size_t                          group_count = groups.size();
+    std::vector<hipblasOperation_t> transA(group_count), transB(group_count);
+    std::vector<I> M(group_count), N(group_count), K(group_count), lda(group_count),
+        ldb(group_count), ldc(group_count), group_size(group_count);
+
+    for(size_t g = 0; g < group_count; g++)
+    {
+        transA[g]     = groups[g].transA;
+        transB[g]     = groups[g].transB;
+        M[g]          = groups[g].M;
+        N[g]          = groups[g].N;
+        K[g]          = groups[g].K;
+        lda[g]        = groups[g].lda;
+        ldb[g]        = groups[g].ldb;
+        ldc[g]        = groups[g].ldc;
+        group_size[g] = groups[g].group_size;
+    }
+
+    auto hipblasGemmGroupedBatchedExFn = [](auto... args) {
+        if constexpr(std::is_same_v<I, int64_t>)
+            return hipblasGemmGroupedBatchedEx_64(args...);
+        else
+            return hipblasGemmGroupedBatchedEx(args...);
+    };
+    return hipblasGemmGroupedBatchedExFn(handle,
+                                         transA.data(),
+                                         transB.data(),
+                                         M.data(),
+                                         N.data(),
+                                         K.data(),
+                                         alpha,
+                                         A,
+                                         a_type,
+                                         lda.data(),
+                                         B,
+                                         b_type,
+                                         ldb.data(),
+                                         beta,
+                                         C,
+                                         c_type,
+                                         ldc.data(),
+                                         I(group_count),
+                                         group_size.data(),
+                                         compute_type);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int64_t M = arg.M;
+    int64_t N = arg.N;
+    int64_t K = arg.K;
+
+    int64_t lda = arg.lda;
+    int64_t ldb = arg.ldb;
+    int64_t ldc = arg.ldc;
+
+    int64_t batch_count = arg.batch_count;
+
+    hipblasDatatype_t a_type = arg.a_type;
+    hipblasDatatype_t b_type = arg.b_type;
+    hipblasDatatype_t c_type = arg.c_type;
+
+#ifdef HIPBLAS_V2
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+#else
+    hipblasDatatype_t compute_type = arg.compute_type;
+#endif
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    hipblasLocalHandle handle(arg);
+
+    auto gemm_grouped_fn = [&](const std::vector<gemm_group_sizes>& groups,
+                               const Tex*                           alpha,
+                               const void* const                    A[],
+                               const void* const                    B[],
+                               const Tex*                           beta,
+                               void* const                          C[]) {
+        if(arg.api & c_API_64)
+            return gemm_grouped_batched_ex_call<int64_t>(
+                handle, groups, alpha, A, a_type, B, b_type, beta, C, c_type, compute_type);
+        return gemm_grouped_batched_ex_call<int>(
+            handle, groups, alpha, A, a_type, B, b_type, beta, C, c_type, compute_type);
+    };
+
+    // The first group is the one described by arg; the second one has the operations swapped and
+    // the sizes permuted, one more instance and beta == 0; the third one is empty.
+    hipblasOperation_t transA_1 = transB, transB_1 = transA;
+    int64_t            M_1 = N, N_1 = M, K_1 = K;
+
+    std::vector<gemm_group_sizes> groups
+        = {{transA, transB, M, N, K, lda, ldb, ldc, batch_count},
+           {transA_1,
+            transB_1,
+            M_1,
+            N_1,
+            K_1,
+            std::max(transA_1 == HIPBLAS_OP_N ? M_1 : K_1, int64_t(1)),
+            std::max(transB_1 == HIPBLAS_OP_N ? K_1 : N_1, int64_t(1)),
+            std::max(M_1, int64_t(1)),
+            batch_count + 1},
+           {transA, transB, M, N, K, lda, ldb, ldc, 0}};
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < groups[0].A_row()
+                        || ldb < groups[0].B_row() || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        groups.resize(1);
+        EXPECT_HIPBLAS_STATUS(
+            gemm_grouped_fn(groups, nullptr, nullptr, nullptr, nullptr, nullptr),
+            invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS);
+
+        return;
+    }
+
+    std::vector<Tex> h_alpha(groups.size(), h_alpha_Tex);
+    std::vector<Tex> h_beta(groups.size(), h_beta_Tex);
+    h_beta[1] = Tex{};
+
+    // All instances of all groups are held in one batch matrix large enough for each of them
+    int64_t instance_count = 0, A_row = 1, A_col = 1, B_row = 1, B_col = 1, C_col = 1;
+    int64_t lda_max = 1, ldb_max = 1, ldc_max = 1;
+    for(const auto& group : groups)
+    {
+        instance_count += group.group_size;
+        A_row   = std::max(A_row, group.A_row());
+        A_col   = std::max(A_col, group.A_col());
+        B_row   = std::max(B_row, group.B_row());
+        B_col   = std::max(B_col, group.B_col());
+        C_col   = std::max(C_col, group.N);
+        lda_max = std::max(lda_max, group.lda);
+        ldb_max = std::max(ldb_max, group.ldb);
+        ldc_max = std::max(ldc_max, group.ldc);
+    }
+    int64_t C_row = ldc_max;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_batch_matrix<Ti> hA(A_row, A_col, lda_max, instance_count);
+    host_batch_matrix<Ti> hB(B_row, B_col, ldb_max, instance_count);
+    host_batch_matrix<To> hC_host(C_row, C_col, ldc_max, instance_count);
+    host_batch_matrix<To> hC_device(C_row, C_col, ldc_max, instance_count);
+    host_batch_matrix<To> hC_gold(C_row, C_col, ldc_max, instance_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC_host.memcheck());
+    CHECK_HIP_ERROR(hC_device.memcheck());
+    CHECK_HIP_ERROR(hC_gold.memcheck());
+
+    // Allocate device memory
+    device_batch_matrix<Ti> dA(A_row, A_col, lda_max, instance_count);
+    device_batch_matrix<Ti> dB(B_row, B_col, ldb_max, instance_count);
+    device_batch_matrix<To> dC(C_row, C_col, ldc_max, instance_count);
+    device_vector<Tex>      d_alpha(groups.size());
+    device_vector<Tex>      d_beta(groups.size());
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    // Initial Data on CPU
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_alpha, h_alpha.data(), sizeof(Tex) * groups.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_beta, h_beta.data(), sizeof(Tex) * groups.size(), hipMemcpyHostToDevice));
+
+    const void* const* dA_array = (const void* const*)dA.ptr_on_device();
+    const void* const* dB_array = (const void* const*)dB.ptr_on_device();
+    void* const*       dC_array = (void* const*)dC.ptr_on_device();
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(gemm_grouped_fn(
+            groups, h_alpha.data(), dA_array, dB_array, h_beta.data(), dC_array));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            gemm_grouped_fn(groups, d_alpha, dA_array, dB_array, d_beta, dC_array));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        // check for float16/bfloat16 input
+        bool gfx11_tolerance
+            = (getArchMajor() == 11)
+              && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                  || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                  || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{}));
+
+        // CPU BLAS
+        int64_t first = 0;
+        for(size_t g = 0; g < groups.size(); g++)
+        {
+            const gemm_group_sizes& group = groups[g];
+            for(int64_t b = first; b < first + group.group_size; b++)
+            {
+                ref_gemm<Ti, To, Tex>(group.transA,
+                                      group.transB,
+                                      group.M,
+                                      group.N,
+                                      group.K,
+                                      h_alpha[g],
+                                      hA[b],
+                                      group.lda,
+                                      hB[b],
+                                      group.ldb,
+                                      h_beta[g],
+                                      hC_gold[b],
+                                      group.ldc);
+            }
+
+            for(int64_t b = first; b < first + group.group_size; b++)
+            {
+                if(unit_check)
+                {
+                    if(gfx11_tolerance)
+                    {
+                        const double tol = group.K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+                        near_check_general<To>(
+                            group.M, group.N, group.ldc, hC_gold[b], hC_host[b], tol);
+                        near_check_general<To>(
+                            group.M, group.N, group.ldc, hC_gold[b], hC_device[b], tol);
+                    }
+                    else
+                    {
+                        unit_check_general<To>(
+                            group.M, group.N, group.ldc, hC_gold[b], hC_host[b]);
+                        unit_check_general<To>(
+                            group.M, group.N, group.ldc, hC_gold[b], hC_device[b]);
+                    }
+                }
+
+                if(norm_check)
+                {
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        norm_check_general<To>(
+                            'F', group.M, group.N, group.ldc, hC_gold[b], hC_host[b]));
+                    hipblas_error_device = std::max(
+                        hipblas_error_device,
+                        norm_check_general<To>(
+                            'F', group.M, group.N, group.ldc, hC_gold[b], hC_device[b]));
+                }
+            }
+            first += group.group_size;
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            gemm_grouped_fn(groups, h_alpha.data(), dA_array, dB_array, h_beta.data(), dC_array);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // log_args scales the counts by batch_count, so they are given per instance of the
+        // first group
+        double gflops = 0, gbytes = 0;
+        for(const auto& group : groups)
+        {
+            gflops += group.group_size * gemm_gflop_count<Tex>(group.M, group.N, group.K);
+            gbytes += group.group_size * gemm_gbyte_count<Tex>(group.M, group.N, group.K);
+        }
+
+        hipblasGemmGroupedBatchedExModel{}.log_args<To>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gflops / batch_count,
+                                                        gbytes / batch_count,
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+}
@@ -0,0 +1,504 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmQuantizedExModel = ArgumentModel<e_a_type,
+                                                  e_c_type,
+                                                  e_compute_type,
+                                                  e_transA,
+                                                  e_transB,
+                                                  e_M,
+                                                  e_N,
+                                                  e_K,
+                                                  e_lda,
+                                                  e_ldb,
+                                                  e_ldc>;
+
+inline void testname_gemm_quantized_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmQuantizedExModel{}.test_name(arg, name);
+}
+
+// The C type of hipblasGemmQuantizedEx for To, independent of HIPBLAS_V2
+template <typename To>
+constexpr hipDataType hipblas_quantized_c_type = std::is_same<To, int8_t>{} ? HIP_R_8I
+                                                                            : HIP_R_16F;
+
+// An int8 C is tested with a non-zero offset; a half C takes none
+template <typename To>
+constexpr int32_t hipblas_quantized_zero_point = std::is_same<To, int8_t>{} ? -3 : 0;
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_quantized_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType cType     = hipblas_quantized_c_type<To>;
+    int32_t     zeroPoint = hipblas_quantized_zero_point<To>;
+
+    int64_t M   = 101;
+    int64_t N   = 100;
+    int64_t K   = 102;
+    int64_t lda = 103;
+    int64_t ldb = 104;
+    int64_t ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_matrix<Ti>    dA(M, K, lda);
+    device_matrix<Ti>    dB(K, N, ldb);
+    device_matrix<To>    dC(M, N, ldc);
+    device_vector<float> d_row_scale(M);
+    device_vector<float> d_col_scale(N);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(nullptr,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 zeroPoint,
+                                                 dC,
+                                                 cType,
+                                                 ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                 (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 zeroPoint,
+                                                 dC,
+                                                 cType,
+                                                 ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    // int32 C is GemmEx
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 0,
+                                                 dC,
+                                                 HIP_R_32I,
+                                                 ldc),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 zeroPoint,
+                                                 dC,
+                                                 cType,
+                                                 M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 zeroPoint,
+                                                 nullptr,
+                                                 cType,
+                                                 ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A half C has no zero point
+    EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 dA,
+                                                 lda,
+                                                 dB,
+                                                 ldb,
+                                                 d_row_scale,
+                                                 d_col_scale,
+                                                 1,
+                                                 dC,
+                                                 HIP_R_16F,
+                                                 ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     nullptr,
+                                                     lda,
+                                                     dB,
+                                                     ldb,
+                                                     d_row_scale,
+                                                     d_col_scale,
+                                                     zeroPoint,
+                                                     dC,
+                                                     cType,
+                                                     ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     dA,
+                                                     lda,
+                                                     nullptr,
+                                                     ldb,
+                                                     d_row_scale,
+                                                     d_col_scale,
+                                                     zeroPoint,
+                                                     dC,
+                                                     cType,
+                                                     ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If K == 0, A and B can be nullptr
+        CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   0,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   ldb,
+                                                   d_row_scale,
+                                                   d_col_scale,
+                                                   zeroPoint,
+                                                   dC,
+                                                   cType,
+                                                   ldc));
+    }
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                               transA,
+                                               transB,
+                                               0,
+                                               N,
+                                               K,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               ldb,
+                                               nullptr,
+                                               nullptr,
+                                               zeroPoint,
+                                               nullptr,
+                                               cType,
+                                               ldc));
+    CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               0,
+                                               K,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               ldb,
+                                               nullptr,
+                                               nullptr,
+                                               zeroPoint,
+                                               nullptr,
+                                               cType,
+                                               ldc));
+}
+
+template <typename Ti, typename To, typename Tc>
+void testing_gemm_quantized_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int64_t            M      = arg.M;
+    int64_t            N      = arg.N;
+    int64_t            K      = arg.K;
+    int64_t            lda    = arg.lda;
+    int64_t            ldb    = arg.ldb;
+    int64_t            ldc    = arg.ldc;
+
+    hipDataType cType     = hipblas_quantized_c_type<To>;
+    int32_t     zeroPoint = hipblas_quantized_zero_point<To>;
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int64_t A_row = transA == HIPBLAS_OP_N ? M : K;
+    int64_t A_col = transA == HIPBLAS_OP_N ? K : M;
+    int64_t B_row = transB == HIPBLAS_OP_N ? K : N;
+    int64_t B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmQuantizedEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     ldb,
+                                                     nullptr,
+                                                     nullptr,
+                                                     zeroPoint,
+                                                     nullptr,
+                                                     cType,
+                                                     ldc),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // Allocate host memory
+    host_matrix<Ti>    hA(A_row, A_col, lda);
+    host_matrix<Ti>    hB(B_row, B_col, ldb);
+    host_matrix<To>    hC_host(M, N, ldc);
+    host_matrix<To>    hC_device(M, N, ldc);
+    host_matrix<To>    hC_gold(M, N, ldc);
+    host_matrix<To>    hC_gold_columns(M, N, ldc);
+    host_vector<float> h_row_scale(M);
+    host_vector<float> h_col_scale(N);
+
+    // Allocate device memory
+    device_matrix<Ti>    dA(A_row, A_col, lda);
+    device_matrix<Ti>    dB(B_row, B_col, ldb);
+    device_matrix<To>    dC(M, N, ldc);
+    device_vector<float> d_row_scale(M);
+    device_vector<float> d_col_scale(N);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    // Scales spread the products over, and past, the int8 range, so rounding and
+    // saturation are both exercised
+    for(int64_t i = 0; i < M; i++)
+        h_row_scale[i] = float(1 + i % 4) / float(2 * std::max(K, int64_t(1)));
+    for(int64_t j = 0; j < N; j++)
+        h_col_scale[j] = float(1 + j % 8) * 0.75f;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(d_row_scale.transfer_from(h_row_scale));
+    CHECK_HIP_ERROR(d_col_scale.transfer_from(h_col_scale));
+
+    if(unit_check || norm_check)
+    {
+        // The scales are always device vectors; the pointer mode of the handle must not matter
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   d_row_scale,
+                                                   d_col_scale,
+                                                   zeroPoint,
+                                                   dC,
+                                                   cType,
+                                                   ldc));
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        // Only the columns scaled
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   nullptr,
+                                                   d_col_scale,
+                                                   zeroPoint,
+                                                   dC,
+                                                   cType,
+                                                   ldc));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        // The GEMM into the int32 scratch runs in host mode; the caller's mode is restored
+        hipblasPointerMode_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+        int mode_gold = HIPBLAS_POINTER_MODE_DEVICE, mode_used = mode;
+        if(unit_check)
+            unit_check_general<int>(1, 1, 1, &mode_gold, &mode_used);
+
+        // reference BLAS
+        ref_gemm_quantized<To>(transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               hA.data(),
+                               lda,
+                               hB.data(),
+                               ldb,
+                               h_row_scale.data(),
+                               h_col_scale.data(),
+                               zeroPoint,
+                               hC_gold.data(),
+                               ldc);
+        ref_gemm_quantized<To>(transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               hA.data(),
+                               lda,
+                               hB.data(),
+                               ldb,
+                               nullptr,
+                               h_col_scale.data(),
+                               zeroPoint,
+                               hC_gold_columns.data(),
+                               ldc);
+
+        if(unit_check)
+        {
+            unit_check_general<To>(M, N, ldc, hC_gold, hC_host);
+            unit_check_general<To>(M, N, ldc, hC_gold_columns, hC_device);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = hipblas_abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_host));
+            hipblas_error_device = hipblas_abs(
+                norm_check_general<To>('F', M, N, ldc, hC_gold_columns, hC_device));
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmQuantizedEx(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       dB,
+                                                       ldb,
+                                                       d_row_scale,
+                                                       d_col_scale,
+                                                       zeroPoint,
+                                                       dC,
+                                                       cType,
+                                                       ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmQuantizedExModel{}.log_args<To>(std::cout,
+                                                   arg,
+                                                   gpu_time_used,
+                                                   gemm_gflop_count<Tc>(M, N, K),
+                                                   gemm_gbyte_count<Ti>(M, N, K),
+                                                   hipblas_error_host,
+                                                   hipblas_error_device);
+    }
+}
@@ -48,6 +48,7 @@ using hipblasGemmStridedBatchedExModel = ArgumentModel<e_a_type,
                                                        e_ldc,
                                                        e_stride_scale,
                                                        e_batch_count,
+                                                       e_stride_alpha,
                                                        e_with_flags,
                                                        e_flags>;
 // strides not logged
@@ -305,10 +306,115 @@ void testing_gemm_strided_batched_ex_bad_arg(const Arguments& arg)
                                           computeType,
                                           algo, flags));
 
+        // Per-instance scalars
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_INITIALIZED,
+            hipblasGemmStridedBatchedExWithScalarStride, (nullptr, transA, transB, M, N, K, alpha, 1,
+                           dA, aType, lda, stride_A,
+                           dB, bType, ldb, stride_B, beta, 1,
+                           dC, cType, ldc, stride_C, batch_count,
+                           computeType,
+                           algo));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasGemmStridedBatchedExWithScalarStride, (handle, transA, transB, M, N, K, alpha, -1,
+                           dA, aType, lda, stride_A,
+                           dB, bType, ldb, stride_B, beta, 0,
+                           dC, cType, ldc, stride_C, batch_count,
+                           computeType,
+                           algo));
+        DAPI_EXPECT(HIPBLAS_STATUS_INVALID_VALUE,
+            hipblasGemmStridedBatchedExWithScalarStride, (handle, transA, transB, M, N, K, alpha, 0,
+                           dA, aType, lda, stride_A,
+                           dB, bType, ldb, stride_B, beta, -1,
+                           dC, cType, ldc, stride_C, batch_count,
+                           computeType,
+                           algo));
+
         // clang-format on
     }
 }
 
+// fp16 products of 2^17, twice the largest fp16, brought back in range by a float alpha per
+// instance in device pointer mode, where they are not scaled by the GEMM itself
+template <typename Tc>
+void testing_gemm_strided_batched_ex_half_range(const Arguments& arg,
+                                                hipblasHandle_t  handle,
+                                                Tc               compute_type)
+{
+    const int64_t M = 4, N = 3, K = 2, batch_count = 3;
+
+    host_strided_batch_matrix<hipblasHalf> hA(M, K, M, M * K, batch_count);
+    host_strided_batch_matrix<hipblasHalf> hB(K, N, K, K * N, batch_count);
+    host_strided_batch_matrix<hipblasHalf> hC(M, N, M, M * N, batch_count);
+    host_strided_batch_matrix<hipblasHalf> hC_gold(M, N, M, M * N, batch_count);
+    host_vector<float>                     h_alpha(batch_count);
+    host_vector<float>                     h_beta(batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_gold.memcheck());
+
+    for(int64_t b = 0; b < batch_count; b++)
+    {
+        h_alpha[b] = 1.0f / float(1024 << b);
+        h_beta[b]  = b % 2 ? 1.0f : 0.0f;
+        for(int64_t i = 0; i < M * K; i++)
+            hA[b][i] = float_to_half(256.0f);
+        for(int64_t i = 0; i < K * N; i++)
+            hB[b][i] = float_to_half(256.0f);
+        for(int64_t i = 0; i < M * N; i++)
+        {
+            hC[b][i]      = float_to_half(1.0f);
+            hC_gold[b][i] = float_to_half(h_alpha[b] * (K * 65536.0f) + h_beta[b]);
+        }
+    }
+
+    device_strided_batch_matrix<hipblasHalf> dA(M, K, M, M * K, batch_count);
+    device_strided_batch_matrix<hipblasHalf> dB(K, N, K, K * N, batch_count);
+    device_strided_batch_matrix<hipblasHalf> dC(M, N, M, M * N, batch_count);
+    device_vector<float>                     d_alpha(batch_count);
+    device_vector<float>                     d_beta(batch_count);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    DAPI_CHECK(hipblasGemmStridedBatchedExWithScalarStride,
+               (handle,
+                HIPBLAS_OP_N,
+                HIPBLAS_OP_N,
+                M,
+                N,
+                K,
+                d_alpha,
+                1,
+                dA,
+                arg.a_type,
+                M,
+                M * K,
+                dB,
+                arg.b_type,
+                K,
+                K * N,
+                d_beta,
+                1,
+                dC,
+                arg.c_type,
+                M,
+                M * N,
+                batch_count,
+                compute_type,
+                HIPBLAS_GEMM_DEFAULT));
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    unit_check_general<hipblasHalf>(M, N, batch_count, M, M * N, hC_gold, hC);
+}
+
 template <typename Ti, typename To = Ti, typename Tex = To>
 void testing_gemm_strided_batched_ex(const Arguments& arg)
 {
@@ -365,6 +471,22 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
 
     hipblasLocalHandle handle(arg);
 
+    if constexpr(hipblas_is_f8<Ti>)
+    {
+        if(!getArchHasF8())
+            return;
+    }
+
+    // The epilogue applies to the HIPBLAS_V2 form of hipblasGemmStridedBatchedEx, with a real C
+    constexpr bool epilogue_type = std::is_same_v<To, float> || std::is_same_v<To, double>;
+#ifdef HIPBLAS_V2
+    if(arg.epilogue && (!epilogue_type || arg.with_flags))
+        return;
+#else
+    if(arg.epilogue)
+        return;
+#endif
+
     // check here to prevent undefined memory allocation error
     bool invalid_size
         = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
@@ -399,6 +521,11 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         return;
     }
 
+    // With stride_alpha each instance has its own alpha and beta. They change every second
+    // instance, so that runs of instances sharing host scalars are exercised too
+    hipblasStride stride_alpha = arg.stride_alpha;
+    int64_t       scalar_count = stride_alpha ? (batch_count - 1) * stride_alpha + 1 : 1;
+
     // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
     // Allocate host memory
     host_strided_batch_matrix<Ti> hA(A_row, A_col, lda, stride_A, batch_count);
@@ -406,6 +533,8 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     host_strided_batch_matrix<To> hC_host(M, N, ldc, stride_C, batch_count);
     host_strided_batch_matrix<To> hC_device(M, N, ldc, stride_C, batch_count);
     host_strided_batch_matrix<To> hC_gold(M, N, ldc, stride_C, batch_count);
+    host_vector<Tex>              h_alpha(scalar_count);
+    host_vector<Tex>              h_beta(scalar_count);
 
     // Check host memory allocation
     CHECK_HIP_ERROR(hA.memcheck());
@@ -418,8 +547,8 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     device_strided_batch_matrix<Ti> dA(A_row, A_col, lda, stride_A, batch_count);
     device_strided_batch_matrix<Ti> dB(B_row, B_col, ldb, stride_B, batch_count);
     device_strided_batch_matrix<To> dC(M, N, ldc, stride_C, batch_count);
-    device_vector<Tex>              d_alpha(1);
-    device_vector<Tex>              d_beta(1);
+    device_vector<Tex>              d_alpha(scalar_count);
+    device_vector<Tex>              d_beta(scalar_count);
 
     // Check device memory allocation
     CHECK_DEVICE_ALLOCATION(dA.memcheck());
@@ -434,6 +563,16 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         return;
     }
 
+    // Epilogue operands of each instance, packed with leading dimension M
+    const bool          epilogue_bias = arg.epilogue & 1;
+    const bool          epilogue_aux  = arg.epilogue & 8;
+    const hipblasStride stride_bias   = M;
+    const hipblasStride stride_aux    = M * N;
+    host_vector<To>     h_bias(epilogue_bias ? stride_bias * batch_count : 1);
+    host_vector<To>     h_aux(epilogue_aux ? stride_aux * batch_count : 1);
+    device_vector<To>   d_bias(epilogue_bias ? stride_bias * batch_count : 1);
+    device_vector<To>   d_aux(epilogue_aux ? stride_aux * batch_count : 1);
+
     double gpu_time_used, hipblas_error_host, hipblas_error_device;
 
     // Initial Data on CPU
@@ -445,18 +584,80 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
     hC_device.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
 
+    if(arg.epilogue)
+    {
+        hipblas_init_vector(h_bias, arg, hipblas_client_never_set_nan, false, true);
+        hipblas_init_vector(h_aux, arg, hipblas_client_never_set_nan);
+        CHECK_HIP_ERROR(d_bias.transfer_from(h_bias));
+        CHECK_HIP_ERROR(d_aux.transfer_from(h_aux));
+
+        hipblasGemmEpilogue_t epilogue{};
+        epilogue.activation = arg.get_epilogue_activation();
+        epilogue.bias       = epilogue_bias ? (To*)d_bias : nullptr;
+        epilogue.strideBias = stride_bias;
+        epilogue.aux        = epilogue_aux ? (To*)d_aux : nullptr;
+        epilogue.ldAux      = M;
+        epilogue.strideAux  = stride_aux;
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmEpilogue(handle, &epilogue));
+    }
+
+    const double scalar_factor[] = {1.0, -1.0, 0.5};
+    for(int64_t b = 0; b < (stride_alpha ? batch_count : 1); b++)
+    {
+        double alpha_factor = scalar_factor[(b / 2) % 3];
+        double beta_factor  = (b / 2) % 2 ? 0.0 : 1.0;
+
+        h_alpha[b * stride_alpha]
+            = hipblas_isnan(arg.alpha)
+                  ? h_alpha_Tex
+                  : convert_alpha_beta<Tex>(arg.alpha * alpha_factor, arg.alphai * alpha_factor);
+        h_beta[b * stride_alpha]
+            = hipblas_isnan(arg.beta)
+                  ? h_beta_Tex
+                  : convert_alpha_beta<Tex>(arg.beta * beta_factor, arg.betai * beta_factor);
+    }
+
     // copy data from CPU to device
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB));
     CHECK_HIP_ERROR(dC.transfer_from(hC_host));
-    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
 
     if(unit_check || norm_check)
     {
         // hipBLAS
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
-        if(!arg.with_flags)
+        if(stride_alpha)
+        {
+            DAPI_CHECK(hipblasGemmStridedBatchedExWithScalarStride,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha.data(),
+                        stride_alpha,
+                        dA,
+                        a_type,
+                        lda,
+                        stride_A,
+                        dB,
+                        b_type,
+                        ldb,
+                        stride_B,
+                        h_beta.data(),
+                        stride_alpha,
+                        dC,
+                        c_type,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        compute_type,
+                        algo));
+        }
+        else if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmStridedBatchedExFn,
                        (handle,
@@ -516,7 +717,36 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(dC.transfer_from(hC_device));
 
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
-        if(!arg.with_flags)
+        if(stride_alpha)
+        {
+            DAPI_CHECK(hipblasGemmStridedBatchedExWithScalarStride,
+                       (handle,
+                        transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        d_alpha,
+                        stride_alpha,
+                        dA,
+                        a_type,
+                        lda,
+                        stride_A,
+                        dB,
+                        b_type,
+                        ldb,
+                        stride_B,
+                        d_beta,
+                        stride_alpha,
+                        dC,
+                        c_type,
+                        ldc,
+                        stride_C,
+                        batch_count,
+                        compute_type,
+                        algo));
+        }
+        else if(!arg.with_flags)
         {
             DAPI_CHECK(hipblasGemmStridedBatchedExFn,
                        (handle,
@@ -582,23 +812,58 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                   M,
                                   N,
                                   K,
-                                  h_alpha_Tex,
+                                  h_alpha[b * stride_alpha],
                                   hA[b],
                                   lda,
                                   hB[b],
                                   ldb,
-                                  h_beta_Tex,
+                                  h_beta[b * stride_alpha],
                                   hC_gold[b],
                                   ldc);
+
+            if constexpr(epilogue_type)
+            {
+                if(arg.epilogue)
+                    ref_gemm_epilogue<To>(arg.get_epilogue_activation(),
+                                          M,
+                                          N,
+                                          epilogue_bias ? h_bias.data() + b * stride_bias : nullptr,
+                                          epilogue_aux ? h_aux.data() + b * stride_aux : nullptr,
+                                          M,
+                                          hC_gold[b],
+                                          ldc);
+            }
+        }
+
+        // GELU goes through tanh, which the device may round differently from the host
+        double gelu_tol = 0;
+        if constexpr(epilogue_type)
+        {
+            if(arg.epilogue && arg.get_epilogue_activation() == HIPBLAS_GEMM_ACTIVATION_GELU)
+            {
+                for(int64_t b = 0; b < batch_count; b++)
+                    for(int64_t j = 0; j < N; j++)
+                        for(int64_t i = 0; i < M; i++)
+                            gelu_tol = std::max(gelu_tol,
+                                                double(hipblas_abs(hC_gold[b][i + j * ldc])));
+                gelu_tol *= 8 * std::numeric_limits<To>::epsilon();
+            }
         }
 
         if(unit_check)
         {
+            if(gelu_tol > 0)
+            {
+                near_check_general<To>(
+                    M, N, batch_count, ldc, stride_C, hC_gold, hC_host, gelu_tol);
+                near_check_general<To>(
+                    M, N, batch_count, ldc, stride_C, hC_gold, hC_device, gelu_tol);
+            }
             // check for float16/bfloat16 input
-            if((getArchMajor() == 11)
-               && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
-                   || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
-                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+            else if((getArchMajor() == 11)
+                    && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                        || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                        || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
             {
                 const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
                 near_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host, tol);
@@ -610,6 +875,12 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                 unit_check_general<To>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
             }
         }
+        if constexpr(std::is_same_v<Ti, hipblasHalf> && std::is_same_v<To, hipblasHalf>
+                     && std::is_same_v<Tex, float>)
+        {
+            if(unit_check && stride_alpha)
+                testing_gemm_strided_batched_ex_half_range(arg, handle, compute_type);
+        }
         if(arg.norm_check)
         {
             hipblas_error_host
@@ -631,7 +902,36 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
 
-            if(!arg.with_flags)
+            if(stride_alpha)
+            {
+                DAPI_DISPATCH(hipblasGemmStridedBatchedExWithScalarStride,
+                              (handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               h_alpha.data(),
+                               stride_alpha,
+                               dA,
+                               a_type,
+                               lda,
+                               stride_A,
+                               dB,
+                               b_type,
+                               ldb,
+                               stride_B,
+                               h_beta.data(),
+                               stride_alpha,
+                               dC,
+                               c_type,
+                               ldc,
+                               stride_C,
+                               batch_count,
+                               compute_type,
+                               algo));
+            }
+            else if(!arg.with_flags)
             {
                 DAPI_DISPATCH(hipblasGemmStridedBatchedExFn,
                               (handle,
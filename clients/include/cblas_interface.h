@@ -564,6 +564,37 @@ void ref_gemm(hipblasOperation_t transA,
               To*                C,
               int64_t            ldc);
 
+// gemm_quantized: the int32 product of A and B scaled by row_scale[i]*col_scale[j] in float; an
+// int8_t C is rounded to nearest even, offset by zero_point and saturated, a hipblasHalf C is
+// rounded to half precision. A null scale vector counts as ones.
+template <typename To>
+void ref_gemm_quantized(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            m,
+                        int64_t            n,
+                        int64_t            k,
+                        int8_t*            A,
+                        int64_t            lda,
+                        int8_t*            B,
+                        int64_t            ldb,
+                        const float*       row_scale,
+                        const float*       col_scale,
+                        int32_t            zero_point,
+                        To*                C,
+                        int64_t            ldc);
+
+// gemm_epilogue: C = act( C + bias*ones**T ) + aux, as applied by hipblasSetGemmEpilogue. A null
+// bias or aux is not added.
+template <typename T>
+void ref_gemm_epilogue(hipblasGemmActivation_t activation,
+                       int64_t                 m,
+                       int64_t                 n,
+                       const T*                bias,
+                       const T*                aux,
+                       int64_t                 ld_aux,
+                       T*                      C,
+                       int64_t                 ldc);
+
 // dgmm
 template <typename T>
 void ref_dgmm(hipblasSideMode_t side,
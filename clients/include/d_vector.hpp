@@ -36,6 +36,11 @@
 extern size_t g_DVEC_PAD;
 void          d_vector_set_pad_length(size_t pad);
 
+// Block of bytes kept by the device cache, or nullptr, and returns a freed block to the cache;
+// see hipblas_client_set_device_cache in utility.h
+void* hipblas_client_device_cache_take(size_t bytes);
+bool  hipblas_client_device_cache_give(void* ptr, size_t bytes);
+
 //
 // Forward declaration of hipblas_init_nan
 //
@@ -94,8 +99,9 @@ public:
 
     T* device_vector_setup()
     {
-        T* d = nullptr;
-        if(use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess)
+        T* d = use_HMM ? nullptr : static_cast<T*>(hipblas_client_device_cache_take(m_bytes));
+        if(!d
+           && (use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess))
         {
             std::cout << "Warning: hip can't allocate " << m_bytes << " bytes (" << (m_bytes >> 30)
                       << " GB)" << std::endl;
@@ -160,7 +166,8 @@ public:
                 d -= m_pad; // restore to start of alloc
 
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            if(use_HMM || !hipblas_client_device_cache_give(d, m_bytes))
+                CHECK_HIP_ERROR((hipFree)(d));
         }
     }
 };
@@ -242,10 +242,15 @@ private:
     {
         bool success = false;
 
+        if(!this->use_HMM)
+            m_device_data
+                = static_cast<T**>(hipblas_client_device_cache_take(m_batch_count * sizeof(T*)));
         success
-            = (hipSuccess
-               == (!this->use_HMM ? (hipMalloc)(&m_device_data, m_batch_count * sizeof(T*))
-                                  : hipMallocManaged(&m_device_data, m_batch_count * sizeof(T*))));
+            = m_device_data
+              || (hipSuccess
+                  == (!this->use_HMM
+                          ? (hipMalloc)(&m_device_data, m_batch_count * sizeof(T*))
+                          : hipMallocManaged(&m_device_data, m_batch_count * sizeof(T*))));
         if(success)
         {
             success = (nullptr
@@ -315,7 +320,9 @@ private:
         {
             auto tmp_device_data = m_device_data;
             m_device_data        = nullptr;
-            CHECK_HIP_ERROR((hipFree)(tmp_device_data));
+            if(this->use_HMM
+               || !hipblas_client_device_cache_give(tmp_device_data, m_batch_count * sizeof(T*)))
+                CHECK_HIP_ERROR((hipFree)(tmp_device_data));
         }
     }
 };
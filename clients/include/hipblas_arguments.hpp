@@ -147,6 +147,7 @@ struct Arguments
     hipblasStride stride_d; //  stride_d > ldd * N
     hipblasStride stride_x;
     hipblasStride stride_y;
+    hipblasStride stride_alpha = 0; // scalars from one alpha or beta of a batch to the next
 
     int start = 1024;
     int end   = 10240;
@@ -177,6 +178,7 @@ struct Arguments
     uint32_t algo;
     int32_t  solution_index;
     uint32_t flags;
+    uint32_t epilogue = 0; // gemm_ex epilogue stages: 1 bias, 2 ReLU, 4 GELU, 8 aux
     char     function[64];
     char     name[64];
     char     category[64];
@@ -233,6 +235,7 @@ struct Arguments
     OPER(stride_d) SEP               \
     OPER(stride_x) SEP               \
     OPER(stride_y) SEP               \
+    OPER(stride_alpha) SEP           \
     OPER(start) SEP                  \
     OPER(end) SEP                    \
     OPER(step) SEP                   \
@@ -257,6 +260,7 @@ struct Arguments
     OPER(algo) SEP                   \
     OPER(solution_index) SEP         \
     OPER(flags) SEP                  \
+    OPER(epilogue) SEP               \
     OPER(function) SEP               \
     OPER(name) SEP                   \
     OPER(category) SEP               \
@@ -297,6 +301,14 @@ struct Arguments
                        : convert_alpha_beta<T>(alpha, alphai);
     }
 
+    // Activation of the gemm_ex epilogue stages
+    hipblasGemmActivation_t get_epilogue_activation() const
+    {
+        return (epilogue & 4)   ? HIPBLAS_GEMM_ACTIVATION_GELU
+               : (epilogue & 2) ? HIPBLAS_GEMM_ACTIVATION_RELU
+                                : HIPBLAS_GEMM_ACTIVATION_NONE;
+    }
+
     template <typename T>
     T get_beta() const
     {
@@ -312,6 +324,12 @@ struct Arguments
 private:
 };
 
+/*! \brief Applies the options of a hipblas-bench command line, as logged by HIPBLAS_LAYER=bench,
+ *  to arg and returns the name of the benchmark the line is for. Throws std::invalid_argument
+ *  on an option hipblas-bench does not take.
+ */
+std::string hipblas_parse_bench_line(const std::string& line, Arguments& arg);
+
 // We make sure that the Arguments struct is C-compatible
 /*
 static_assert(std::is_standard_layout<Arguments>{},
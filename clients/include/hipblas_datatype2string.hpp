@@ -132,7 +132,12 @@ inline constexpr auto hipblas_datatype2string(hipblasDatatype_t type)
         return "bf16_r";
     case HIPBLAS_C_16B:
         return "bf16_c";
-#ifndef HIPBLAS_V2
+#ifdef HIPBLAS_V2
+    case HIP_R_8F_E4M3_FNUZ:
+        return "f8_fnuz_r";
+    case HIP_R_8F_E5M2_FNUZ:
+        return "bf8_fnuz_r";
+#else
     case HIPBLAS_DATATYPE_INVALID:
         return "invalid";
 #endif
@@ -273,6 +273,32 @@ auto hipblas_gemm_dispatch(const Arguments& arg)
             return hipblas_simple_dispatch<TEST>(arg); // Ti = To = Tc
         }
     }
+#ifdef HIPBLAS_V2
+    // 8-bit float inputs have no hipblasDatatype_t
+    if(arg.b_type == Ti && arg.d_type == To && To == HIPBLAS_R_32F && Tc == HIPBLAS_R_32F)
+    {
+        if(Ti == HIP_R_8F_E4M3_FNUZ)
+            return TEST<hipblasF8E4M3Fnuz, float, float>{}(arg);
+        else if(Ti == HIP_R_8F_E5M2_FNUZ)
+            return TEST<hipblasF8E5M2Fnuz, float, float>{}(arg);
+    }
+#endif
+    return TEST<void>{}(arg);
+}
+
+// gemm_quantized_ex: int8 A and B accumulated in int32, with an int8 or half C
+template <template <typename...> class TEST>
+auto hipblas_gemm_quantized_dispatch(const Arguments& arg)
+{
+    const auto Ti = arg.a_type, To = arg.c_type, Tc = arg.compute_type;
+
+    if(Ti == HIPBLAS_R_8I && arg.b_type == Ti && arg.d_type == To && Tc == HIPBLAS_R_32I)
+    {
+        if(To == HIPBLAS_R_8I)
+            return TEST<int8_t, int8_t, int32_t>{}(arg);
+        else if(To == HIPBLAS_R_16F)
+            return TEST<int8_t, hipblasHalf, int32_t>{}(arg);
+    }
     return TEST<void>{}(arg);
 }
 
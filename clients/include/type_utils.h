@@ -28,10 +28,12 @@
 
 #ifdef __cplusplus
 #include "complex.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <immintrin.h>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -120,6 +122,86 @@ inline float half_to_float(hipblasHalf val)
 #endif
 }
 
+/* =============================================================================================== */
+/* 8-bit floats.                                                                                   */
+
+// Host storage of the FNUZ 8-bit float formats rocBLAS multiplies, with WM mantissa bits and an
+// exponent bias of BIAS. The formats have no infinities and no negative zero; 0x80 is their only
+// NaN. Conversion from float rounds to nearest even and saturates to the largest finite value.
+template <int WM, int BIAS>
+class hipblasF8Fnuz
+{
+public:
+    uint8_t data;
+
+    hipblasF8Fnuz() = default;
+
+    explicit hipblasF8Fnuz(float f)
+        : data(from_float(f))
+    {
+    }
+
+    operator float() const
+    {
+        if(data == 0x80)
+            return std::numeric_limits<float>::quiet_NaN();
+
+        int   exponent = (data & 0x7f) >> WM;
+        int   mantissa = data & ((1 << WM) - 1);
+        float value    = exponent ? std::ldexp(float(mantissa + (1 << WM)), exponent - BIAS - WM)
+                                  : std::ldexp(float(mantissa), 1 - BIAS - WM);
+        return data & 0x80 ? -value : value;
+    }
+
+    hipblasF8Fnuz& operator+=(const hipblasF8Fnuz& a)
+    {
+        *this = hipblasF8Fnuz(float(*this) + float(a));
+        return *this;
+    }
+
+private:
+    static uint8_t from_float(float f)
+    {
+        if(std::isnan(f))
+            return 0x80;
+
+        uint8_t sign = std::signbit(f) ? 0x80 : 0;
+        float   a    = std::fabs(f);
+        if(a == 0)
+            return 0;
+
+        constexpr int max_exponent = (1 << (7 - WM)) - 1;
+        if(a >= std::ldexp(2.0f - std::ldexp(1.0f, -WM), max_exponent - BIAS))
+            return sign | 0x7f;
+
+        // Subnormals share the scale of the smallest normal exponent; rounding up to the next
+        // exponent carries into the exponent field
+        int exponent;
+        std::frexp(a, &exponent);
+        exponent      = std::max(exponent - 1 + BIAS, 1);
+        uint32_t code = uint32_t(std::nearbyint(std::ldexp(a, WM - (exponent - BIAS))))
+                        + (uint32_t(exponent - 1) << WM);
+        code = std::min(code, uint32_t(0x7f));
+        return code ? uint8_t(sign | code) : 0;
+    }
+};
+
+// HIP_R_8F_E4M3_FNUZ and HIP_R_8F_E5M2_FNUZ
+using hipblasF8E4M3Fnuz = hipblasF8Fnuz<3, 8>;
+using hipblasF8E5M2Fnuz = hipblasF8Fnuz<2, 16>;
+
+template <typename T>
+static constexpr bool hipblas_is_f8 = false;
+
+template <int WM, int BIAS>
+HIPBLAS_CLANG_STATIC constexpr bool hipblas_is_f8<hipblasF8Fnuz<WM, BIAS>> = true;
+
+template <int WM, int BIAS>
+inline bool hipblas_isnan(hipblasF8Fnuz<WM, BIAS> arg)
+{
+    return arg.data == 0x80;
+}
+
 /* =============================================================================================== */
 /* Absolute values                                                                                 */
 // template <typename T>
@@ -147,6 +229,14 @@ inline hipblasBfloat16 hipblas_abs(hipblasBfloat16 x)
     return x;
 }
 
+template <int WM, int BIAS>
+inline hipblasF8Fnuz<WM, BIAS> hipblas_abs(hipblasF8Fnuz<WM, BIAS> x)
+{
+    if(x.data != 0x80)
+        x.data &= 0x7f;
+    return x;
+}
+
 // rocblas_half
 inline hipblasHalf hipblas_abs(hipblasHalf x)
 {
@@ -173,6 +173,15 @@ public:
         return random_nan_data<hipblasBfloat16, uint16_t, 7, 8>();
     }
 
+    // The only NaN of the 8-bit float formats
+    template <int WM, int BIAS>
+    explicit operator hipblasF8Fnuz<WM, BIAS>()
+    {
+        hipblasF8Fnuz<WM, BIAS> nan;
+        nan.data = 0x80;
+        return nan;
+    }
+
     // Random NaN Complex
     explicit operator hipblasComplex()
     {
@@ -224,6 +233,15 @@ inline hipblasBfloat16 hipblas_negate(hipblasBfloat16 x)
     return x;
 }
 
+// 0x80 is NaN rather than negative zero
+template <int WM, int BIAS>
+inline hipblasF8Fnuz<WM, BIAS> hipblas_negate(hipblasF8Fnuz<WM, BIAS> x)
+{
+    if(x.data & 0x7f)
+        x.data ^= 0x80;
+    return x;
+}
+
 /* ============================================================================================ */
 /* generate random number :*/
 
@@ -258,6 +276,21 @@ inline hipblasBfloat16 random_generator<hipblasBfloat16>()
         float((rand() % 3 + 1))); // generate an integer number in range [1,2,3]
 }
 
+// for 8-bit floats, generate float, and convert to the 8-bit float
+template <>
+inline hipblasF8E4M3Fnuz random_generator<hipblasF8E4M3Fnuz>()
+{
+    return hipblasF8E4M3Fnuz(
+        float((rand() % 3 + 1))); // generate an integer number in range [1,2,3]
+}
+
+template <>
+inline hipblasF8E5M2Fnuz random_generator<hipblasF8E5M2Fnuz>()
+{
+    return hipblasF8E5M2Fnuz(
+        float((rand() % 3 + 1))); // generate an integer number in range [1,2,3]
+}
+
 // for hipblasComplex, generate 2 floats
 /*! \brief  generate two random numbers in range [1,2,3,4,5,6,7,8,9,10] */
 template <>
@@ -298,6 +331,20 @@ inline hipblasBfloat16 random_generator_negative<hipblasBfloat16>()
     return float_to_bfloat16(-float((rand() % 3 + 1)));
 };
 
+// for 8-bit floats, generate float, and convert to the 8-bit float
+/*! \brief  generate a random number in range [-1,-2,-3] */
+template <>
+inline hipblasF8E4M3Fnuz random_generator_negative<hipblasF8E4M3Fnuz>()
+{
+    return hipblasF8E4M3Fnuz(-float((rand() % 3 + 1)));
+}
+
+template <>
+inline hipblasF8E5M2Fnuz random_generator_negative<hipblasF8E5M2Fnuz>()
+{
+    return hipblasF8E5M2Fnuz(-float((rand() % 3 + 1)));
+}
+
 // for complex, generate two values, convert both to negative
 /*! \brief  generate a random real value in range [-1, -10] and random
 *           imaginary value in range [-1, -10]
@@ -338,6 +385,18 @@ inline hipblasHalf random_hpl_generator()
         float_to_half(std::uniform_real_distribution<float>(-0.5f, 0.5f)(hipblas_rng)));
 }
 
+template <>
+inline hipblasF8E4M3Fnuz random_hpl_generator()
+{
+    return hipblasF8E4M3Fnuz(std::uniform_real_distribution<float>(-0.5f, 0.5f)(hipblas_rng));
+}
+
+template <>
+inline hipblasF8E5M2Fnuz random_hpl_generator()
+{
+    return hipblasF8E5M2Fnuz(std::uniform_real_distribution<float>(-0.5f, 0.5f)(hipblas_rng));
+}
+
 /* ============================================================================================= */
 /*! \brief For testing purposes, prepares matrix hA for a triangular solve.                      *
  *         Makes hA strictly diagonal dominant (SPD), then calculates Cholesky factorization     *
@@ -506,6 +565,9 @@ typedef enum hipblasClientProcessor
 hipblasClientProcessor getArch();
 int                    getArchMajor();
 
+/* whether rocBLAS multiplies 8-bit floats on the current device */
+bool getArchHasF8();
+
 /* ============================================================================================ */
 /*  timing: HIP only provides very limited timers function clock() and not general;
             hipblas sync CPU and device and use more accurate CPU timer*/
@@ -532,6 +594,7 @@ class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    bool            m_owned  = true;
 
 public:
     hipblasLocalHandle();
@@ -556,6 +619,21 @@ public:
     }
 };
 
+/*! \brief  stream bound by hipblasLocalHandle(const Arguments&); nullptr keeps the default
+ *          stream. Used by hipblas-bench --replay to reproduce recorded stream assignment. */
+void hipblas_client_set_stream(hipStream_t stream);
+
+/*! \brief  handle used by hipblasLocalHandle(const Arguments&) instead of a new one, which it
+ *          then does not destroy; nullptr restores the default. Used by hipblas-bench --replay
+ *          to run every call of a recorded handle on one handle. */
+void hipblas_client_set_handle(hipblasHandle_t handle);
+
+/*! \brief  while enabled, device memory freed by the device vectors and matrices is kept and
+ *          handed out again to allocations of the same size, so hipblas-bench --replay runs
+ *          every call on the same buffers without allocating in between. Disabling frees the
+ *          kept memory. */
+void hipblas_client_set_device_cache(bool enable);
+
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status(hipError_t status);
 
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status_and_log(hipError_t status);
@@ -534,6 +534,25 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED = 1 /**< Algorithms will take advantage of atomics where applicable. */
 } hipblasAtomicsMode_t;
 
+/*! \brief Indicates whether hipBLAS may allocate device memory or synchronize the host in calls on a
+ *         handle, which is not allowed while its stream is captured into a graph. See
+ *         hipblasSetGraphCaptureMode(). */
+typedef enum
+{
+    HIPBLAS_GRAPH_CAPTURE_DEFAULT
+    = 0, /**< Device memory is grown on demand, except while the stream is captured. */
+    HIPBLAS_GRAPH_CAPTURE_SAFE
+    = 1 /**< No device memory is allocated and the host is not synchronized in calls. */
+} hipblasGraphCaptureMode_t;
+
+/*! \brief Indicates the layout of the matrices passed to the functions called on a handle. See
+ *         hipblasSetOrder(). */
+typedef enum
+{
+    HIPBLAS_ORDER_COLUMN_MAJOR = 0, /**< Each column is contiguous in memory, as in Fortran BLAS. */
+    HIPBLAS_ORDER_ROW_MAJOR    = 1 /**< Each row is contiguous in memory, as in C. */
+} hipblasOrder_t;
+
 /*! \brief Control flags passed into gemm ex with flags algorithms. Only relevant with rocBLAS backend. See rocBLAS documentation
  *         for more information.*/
 typedef enum
@@ -796,6 +815,350 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Provide a caller-owned device buffer for the handle to use as workspace
+
+    \details
+    Once a workspace is set, hipBLAS functions called with this handle take their temporary
+    device memory from it instead of allocating, so no device allocation happens on the
+    call path. On the rocBLAS backend this maps to rocblas_set_workspace(), on the cuBLAS
+    backend to cublasSetWorkspace(). A function needing more memory than was provided returns
+    HIPBLAS_STATUS_ALLOC_FAILED. The same buffer may be shared by several handles as long as
+    they all enqueue work on the same stream.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    workspace   pointer to device memory owned by the caller. It must stay allocated until the
+                handle is destroyed or another workspace is set. Passing nullptr and a size of
+                0 returns the handle to library-managed memory.
+    @param[in]
+    workspaceSizeInBytes [size_t]
+                size of workspace in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle,
+                                                   void*           workspace,
+                                                   size_t          workspaceSizeInBytes);
+
+/*! \brief Get the workspace size the handle requires
+
+    \details
+    Returns the device memory, in bytes, needed by the functions called on this handle so far.
+    Use hipblasQueryWorkspaceSize() to size a workspace for given calls without running them.
+
+    On the cuBLAS backend the value is not a requirement: cuBLAS does not report how much
+    workspace its functions need, so the default workspace size cuBLAS documents for the
+    current device (4 MiB, or 32 MiB from compute capability 9.0) is returned, whatever the
+    functions called. The host backend uses no device memory and returns 0.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    workspaceSizeInBytes [size_t*]
+                returns the required workspace size in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle,
+                                                       size_t*         workspaceSizeInBytes);
+
+/*! \brief Function making the hipBLAS calls to size a workspace for, see
+ *         hipblasQueryWorkspaceSize(). Returns the first error of the calls. */
+typedef hipblasStatus_t (*hipblasWorkspaceCalls_t)(hipblasHandle_t handle, void* userData);
+
+/*! \brief Get the workspace size a set of calls requires
+
+    \details
+    Calls calls(handle, userData) with the handle in device memory size query mode, and
+    returns the device memory, in bytes, the hipBLAS calls it makes on handle need: the size of
+    the buffer to pass to hipblasSetWorkspace() for them. calls should make each call once with
+    the sizes, types and modes it will run with. In query mode the calls read and write no data
+    and queue no work, so the pointers passed only need to be valid where a call checks them
+    for nullptr.
+
+    On the rocBLAS backend this runs the calls in rocBLAS device memory size query mode
+    (rocblas_start_device_memory_size_query()). The cuBLAS backend returns
+    HIPBLAS_STATUS_NOT_SUPPORTED without calling calls, as cuBLAS has no such query; see
+    hipblasGetWorkspaceSize(). The host backend returns 0 without calling calls.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    calls       [hipblasWorkspaceCalls_t]
+                function making the calls on handle.
+    @param[in]
+    userData    passed to calls.
+    @param[out]
+    workspaceSizeInBytes [size_t*]
+                returns the required workspace size in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasQueryWorkspaceSize(hipblasHandle_t         handle,
+                                                         hipblasWorkspaceCalls_t calls,
+                                                         void*                   userData,
+                                                         size_t* workspaceSizeInBytes);
+
+/*! \brief Set the graph capture mode of a handle
+
+    \details
+    In HIPBLAS_GRAPH_CAPTURE_SAFE mode, functions called with the handle never allocate or
+    resize device memory and never synchronize the host, so they can be captured into a HIP
+    graph. A function needing more device memory than the handle holds returns
+    HIPBLAS_STATUS_ALLOC_FAILED, and one which can only run with a host synchronization, such as
+    an emulated batched function reading a device array of pointers on the cuBLAS backend,
+    returns HIPBLAS_STATUS_NOT_SUPPORTED. On the cuBLAS backend, the strided batched functions
+    that cuBLAS only offers with arrays of pointers, such as trsmStridedBatched, build those
+    arrays in temporary device memory and so also return HIPBLAS_STATUS_NOT_SUPPORTED; other
+    emulated functions fall back to a path without temporary memory.
+    hipblasPrepareForGraphCapture() sizes the device memory and sets this mode.
+
+    In the default mode, the rocBLAS backend grows the device memory of the handle when a
+    function needs more, except while the stream of the handle is being captured, when the
+    function fails as in HIPBLAS_GRAPH_CAPTURE_SAFE mode instead of invalidating the capture.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    mode        [hipblasGraphCaptureMode_t]
+                graph capture mode.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGraphCaptureMode(hipblasHandle_t           handle,
+                                                          hipblasGraphCaptureMode_t mode);
+
+/*! \brief Get the graph capture mode of a handle, see hipblasSetGraphCaptureMode() */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGraphCaptureMode(hipblasHandle_t            handle,
+                                                          hipblasGraphCaptureMode_t* mode);
+
+/*! \brief Set the layout of the matrices passed to functions called on a handle
+
+    \details
+    In HIPBLAS_ORDER_ROW_MAJOR order the Level 2 and Level 3 functions, the GEMM extensions and
+    the solver functions take matrices stored row by row, with the leading dimension the distance
+    between the starts of two rows, as CBLAS does with CblasRowMajor. Matrix sizes, operations,
+    fill modes and sides keep their meaning, and the batched forms take the same strides. No data
+    is transposed: a row-major matrix is the transpose of the column-major matrix in the same
+    memory, so each call is remapped to the column-major call which computes the transpose of its
+    result, with operands, dimensions and operations swapped and upper and lower, and left and
+    right, exchanged.
+
+    Calls which have no such remapping return HIPBLAS_STATUS_NOT_SUPPORTED in row-major order:
+    - gemv, gbmv, trmv, trsv, tbmv, tbsv, tpmv, tpsv, syrk, syr2k and syrkx with a complex
+      conjugate-transposed matrix, and gerc, hemv, hbmv, hpmv, her, her2, hpr and hpr2, which would
+      need a conjugated copy of a vector or a matrix.
+    - trsmEx with an invA, whose blocks are laid out for a column-major A.
+    - the solver functions (getrf, getrs, getri, geqrf and gels).
+    - gemmEx with an epilogue set with hipblasSetGemmEpilogue().
+
+    Level 1 functions take vectors only and are not affected. Calls are logged by
+    HIPBLAS_LAYER as the column-major calls they run as. The default order is
+    HIPBLAS_ORDER_COLUMN_MAJOR.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    order       [hipblasOrder_t]
+                layout of the matrices.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetOrder(hipblasHandle_t handle, hipblasOrder_t order);
+
+/*! \brief Get the layout of the matrices passed to functions called on a handle, see
+ *         hipblasSetOrder() */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetOrder(hipblasHandle_t handle, hipblasOrder_t* order);
+
+/*! \brief Allocate the device memory of a handle up front and make it safe to capture
+
+    \details
+    Sizes the device memory of the handle for the calls to be captured, then sets
+    HIPBLAS_GRAPH_CAPTURE_SAFE mode. calls(handle, userData) should make each call to be
+    captured once, with the sizes, types and modes it will be captured with; the calls are made
+    in device memory size query mode, as by hipblasQueryWorkspaceSize(), so they read and write
+    no data and queue no work. The memory is sized to hold the largest of what they need,
+    workspaceSizeInBytes, and what the functions called on the handle so far need, as reported
+    by hipblasGetWorkspaceSize(). calls may be nullptr, in which case the calls to be captured
+    must have been run on the handle before.
+
+    On the rocBLAS backend this also allocates the scratch memory hipBLAS uses for intermediate
+    results, such as the product of hipblasGemmQuantizedEx(), and the memory no longer grows
+    afterwards, including for functions which do not go through hipBLAS's own sizing. On the
+    cuBLAS backend, which cannot report what its functions need, calls is not called and
+    workspaceSizeInBytes is ignored: cuBLAS sizes its own workspace, and
+    hipblasSetWorkspace() gives it one. Only the auxiliary streams used to emulate batched
+    functions are created there.
+
+    If a workspace was set with hipblasSetWorkspace(), it is not replaced, and
+    HIPBLAS_STATUS_ALLOC_FAILED is returned when it is smaller than required.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    calls       [hipblasWorkspaceCalls_t]
+                function making the calls to be captured on handle; may be nullptr.
+    @param[in]
+    userData    passed to calls.
+    @param[in]
+    workspaceSizeInBytes [size_t]
+                minimum device memory of the handle in bytes; may be 0.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasPrepareForGraphCapture(hipblasHandle_t         handle,
+                                                             hipblasWorkspaceCalls_t calls,
+                                                             void*                   userData,
+                                                             size_t workspaceSizeInBytes);
+
+/*! \brief Call statistics of one routine and precision on a handle, see hipblasGetHandleStats() */
+typedef struct hipblasRoutineStats_t
+{
+    char     routine[64]; /**< routine as named by hipblas-bench -f, e.g. gemm_strided_batched */
+    char     precision[16]; /**< precision as named by hipblas-bench -r, e.g. f32_r */
+    uint64_t calls; /**< number of calls */
+    double   hostTimeUs; /**< host time spent inside the calls, in microseconds */
+    double   gflops; /**< estimated floating point operations of the calls, in billions */
+    double   gbytes; /**< estimated bytes moved by the calls, in billions */
+} hipblasRoutineStats_t;
+
+/*! \brief Get the call statistics of a handle
+
+    \details
+    Returns, for each routine and precision called on the handle since it was created or since
+    hipblasResetHandleStats(), the number of calls, the host time spent dispatching them and
+    the flops and bytes they are estimated to process, using the counts that hipblas-bench
+    reports. The calls are only counted when the application runs with the stats layer,
+    HIPBLAS_LAYER=stats (or 32); otherwise no routines are returned. Calls that hipBLAS makes to
+    itself are counted as part of the call they are made from. The number of times hipBLAS grew
+    the device memory of the handle is always counted; it stays 0 on the cuBLAS and host
+    backends, where hipBLAS does not manage that memory.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    stats       array of count entries to fill in, ordered by routine and precision. If
+                nullptr, only the number of entries available is returned in count.
+    @param[inout]
+    count       [int*]
+                on entry, the number of entries of stats; on exit, the number of entries
+                filled in, or available if stats is nullptr.
+    @param[out]
+    workspaceReallocations [uint64_t*]
+                optional, returns the number of device memory reallocations of the handle.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetHandleStats(hipblasHandle_t        handle,
+                                                     hipblasRoutineStats_t* stats,
+                                                     int*                   count,
+                                                     uint64_t*              workspaceReallocations);
+
+/*! \brief Clear the call statistics and reallocation count of a handle */
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetHandleStats(hipblasHandle_t handle);
+
+/*! \brief Pool of hipBLAS handles, see hipblasHandlePoolCreate() */
+typedef struct hipblasHandlePool* hipblasHandlePool_t;
+
+/*! \brief Create a pool of hipBLAS handles on the current device
+
+    \details
+    Creating a handle is expensive, so applications which run each request on its own thread
+    can check handles out of a pool instead of calling hipblasCreate() and hipblasDestroy() per
+    request. The handles of the pool are created up front on the device current to the calling
+    thread, with their device memory allocated, and keep it between checkouts, so a returned
+    handle does not need to grow its workspace again. Checking a handle out and back in does not
+    take a lock.
+
+    @param[out]
+    pool        [hipblasHandlePool_t*]
+                returns the pool.
+    @param[in]
+    size        [int]
+                number of handles kept in the pool. When all of them are checked out,
+                hipblasHandlePoolAcquire() creates an extra handle, which is destroyed when it is
+                released to a full pool.
+    @param[in]
+    workspaceSizeInBytes [size_t]
+                device memory allocated for each handle, as by hipblasPrepareForGraphCapture(),
+                when it is created. 0 leaves the handles to allocate it on their first calls.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool,
+                                                       int                  size,
+                                                       size_t               workspaceSizeInBytes);
+
+/*! \brief Destroy a pool and its handles
+
+    \details
+    All handles checked out of the pool must have been released. Otherwise
+    HIPBLAS_STATUS_INVALID_VALUE is returned and the pool is left in place.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool);
+
+/*! \brief Check a handle out of a pool
+
+    \details
+    The handle is set to enqueue work on stream. A thread tends to get back the handle it last
+    released, so a thread which always passes its own stream does not rebind the handle. The
+    other settings are those of a new handle: hipblasHandlePoolRelease() restores the pointer,
+    math and atomics modes, the order, the GemmEx epilogue and scales and the graph capture mode
+    a previous user set. A workspace given with hipblasSetWorkspace() is not restored and must
+    be removed before the handle is released. The device current to the calling thread must be
+    the device of the pool; otherwise HIPBLAS_STATUS_INVALID_VALUE is returned.
+
+    @param[in]
+    pool        [hipblasHandlePool_t]
+                pool created by hipblasHandlePoolCreate().
+    @param[in]
+    stream      [hipStream_t]
+                stream the handle is set to, as by hipblasSetStream().
+    @param[out]
+    handle      [hipblasHandle_t*]
+                returns the handle, to be passed back to hipblasHandlePoolRelease() and not to
+                hipblasDestroy().
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                        hipStream_t         stream,
+                                                        hipblasHandle_t*    handle);
+
+/*! \brief Return a handle checked out by hipblasHandlePoolAcquire() to its pool
+
+    \details
+    Returns HIPBLAS_STATUS_INVALID_VALUE, and leaves the pool as it was, for a handle that is
+    not checked out of pool, including one released already.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t     handle);
+
+/*! \brief Turn GEMM solution tuning on or off for the process
+
+    \details
+    While tuning is on, the first hipblasGemmEx, hipblasGemmBatchedEx or
+    hipblasGemmStridedBatchedEx call with a given problem on a device times every solution
+    rocBLAS offers for it, and later calls with the same problem run the fastest one. Setting
+    the environment variable HIPBLAS_GEMM_TUNING to a non-zero value turns tuning on from the
+    start. Solutions found remain in use after tuning is turned off. The math mode the GEMM
+    runs with is part of the problem, so the same GEMM is tuned separately for each mode.
+
+    Only the rocBLAS backend tunes GEMMs; the other backends return
+    HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    @param[in]
+    enable      [int]
+                non-zero to tune GEMMs, 0 to stop tuning them.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmTuning(int enable);
+
+/*! \brief Write the GEMM solutions found by tuning to a database file
+
+    \details
+    The file holds one solution per problem and GPU architecture, and includes the solutions
+    read from HIPBLAS_GEMM_TUNING_DB. A process started with HIPBLAS_GEMM_TUNING_DB naming the
+    file reads it in its first hipblasCreate() and runs the GEMMs it covers with their tuned
+    solution, without tuning them again. hipblas-bench --tune writes such a file for the GEMMs
+    of a yaml file. Each problem includes its math mode; files written before the math mode
+    was recorded are still read, as tuned with the default math mode.
+
+    @param[in]
+    path        [const char*]
+                name of the file to write.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaveGemmTuning(const char* path);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -20092,6 +20455,300 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2_64(hipblasHandle_t
                                                                 int64_t                 batchCount);
 //! @}
 
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmGroupedBatched performs groupCount batched matrix-matrix operations, each group with its
+    own sizes, operations and scalars:
+
+        C_i = alpha_g*op_g( A_i )*op_g( B_i ) + beta_g*C_i, for the groupSize[g] instances i of group g,
+
+    where op_g( X ) is one of
+
+        op_g( X ) = X      or
+        op_g( X ) = X**T   or
+        op_g( X ) = X**H,
+
+    as given by transA_array[g] and transB_array[g], op_g( A_i ) is an m_array[g] by k_array[g] matrix,
+    op_g( B_i ) a k_array[g] by n_array[g] matrix and C_i an m_array[g] by n_array[g] matrix.
+
+    The instances of all groups are stored one group after the other in A_array, B_array and C_array,
+    which hold groupSize[0] + ... + groupSize[groupCount - 1] device pointers each. All other arrays
+    have groupCount entries and are in host memory, except alpha_array and beta_array which follow
+    the pointer mode of the handle.
+
+    With the cuBLAS backend, s and d map to cublas<t>gemmGroupedBatched from CUDA 12.5 on when the
+    pointer mode is host; otherwise, and with the rocBLAS backend, the groups are issued one after the
+    other as batched GEMMs on the stream of the handle.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA_array [hipblasOperation_t]
+              host array of groupCount operations op( A ).
+    @param[in]
+    transB_array [hipblasOperation_t]
+              host array of groupCount operations op( B ).
+    @param[in]
+    m_array   [int]
+              host array of groupCount matrix dimensions m.
+    @param[in]
+    n_array   [int]
+              host array of groupCount matrix dimensions n.
+    @param[in]
+    k_array   [int]
+              host array of groupCount matrix dimensions k.
+    @param[in]
+    alpha_array
+              device array or host array of groupCount scalars alpha.
+    @param[in]
+    A_array   device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda_array [int]
+              host array of groupCount leading dimensions of the A_i.
+    @param[in]
+    B_array   device array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb_array [int]
+              host array of groupCount leading dimensions of the B_i.
+    @param[in]
+    beta_array
+              device array or host array of groupCount scalars beta.
+    @param[in, out]
+    C_array   device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc_array [int]
+              host array of groupCount leading dimensions of the C_i.
+    @param[in]
+    groupCount
+              [int]
+              number of groups.
+    @param[in]
+    groupSize [int]
+              host array of groupCount numbers of gemm operations in each group.
+     ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmGroupedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t transA_array[],
+                                                          const hipblasOperation_t transB_array[],
+                                                          const int                m_array[],
+                                                          const int                n_array[],
+                                                          const int                k_array[],
+                                                          const float              alpha_array[],
+                                                          const float* const       A_array[],
+                                                          const int                lda_array[],
+                                                          const float* const       B_array[],
+                                                          const int                ldb_array[],
+                                                          const float              beta_array[],
+                                                          float* const             C_array[],
+                                                          const int                ldc_array[],
+                                                          int                      groupCount,
+                                                          const int                groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmGroupedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t transA_array[],
+                                                          const hipblasOperation_t transB_array[],
+                                                          const int                m_array[],
+                                                          const int                n_array[],
+                                                          const int                k_array[],
+                                                          const double             alpha_array[],
+                                                          const double* const      A_array[],
+                                                          const int                lda_array[],
+                                                          const double* const      B_array[],
+                                                          const int                ldb_array[],
+                                                          const double             beta_array[],
+                                                          double* const            C_array[],
+                                                          const int                ldc_array[],
+                                                          int                      groupCount,
+                                                          const int                groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgemmGroupedBatched(hipblasHandle_t             handle,
+                               const hipblasOperation_t    transA_array[],
+                               const hipblasOperation_t    transB_array[],
+                               const int                   m_array[],
+                               const int                   n_array[],
+                               const int                   k_array[],
+                               const hipblasComplex        alpha_array[],
+                               const hipblasComplex* const A_array[],
+                               const int                   lda_array[],
+                               const hipblasComplex* const B_array[],
+                               const int                   ldb_array[],
+                               const hipblasComplex        beta_array[],
+                               hipblasComplex* const       C_array[],
+                               const int                   ldc_array[],
+                               int                         groupCount,
+                               const int                   groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmGroupedBatched(hipblasHandle_t                   handle,
+                               const hipblasOperation_t          transA_array[],
+                               const hipblasOperation_t          transB_array[],
+                               const int                         m_array[],
+                               const int                         n_array[],
+                               const int                         k_array[],
+                               const hipblasDoubleComplex        alpha_array[],
+                               const hipblasDoubleComplex* const A_array[],
+                               const int                         lda_array[],
+                               const hipblasDoubleComplex* const B_array[],
+                               const int                         ldb_array[],
+                               const hipblasDoubleComplex        beta_array[],
+                               hipblasDoubleComplex* const       C_array[],
+                               const int                         ldc_array[],
+                               int                               groupCount,
+                               const int                         groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgemmGroupedBatched_v2(hipblasHandle_t          handle,
+                                  const hipblasOperation_t transA_array[],
+                                  const hipblasOperation_t transB_array[],
+                                  const int                m_array[],
+                                  const int                n_array[],
+                                  const int                k_array[],
+                                  const hipComplex         alpha_array[],
+                                  const hipComplex* const  A_array[],
+                                  const int                lda_array[],
+                                  const hipComplex* const  B_array[],
+                                  const int                ldb_array[],
+                                  const hipComplex         beta_array[],
+                                  hipComplex* const        C_array[],
+                                  const int                ldc_array[],
+                                  int                      groupCount,
+                                  const int                groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmGroupedBatched_v2(hipblasHandle_t               handle,
+                                  const hipblasOperation_t      transA_array[],
+                                  const hipblasOperation_t      transB_array[],
+                                  const int                     m_array[],
+                                  const int                     n_array[],
+                                  const int                     k_array[],
+                                  const hipDoubleComplex        alpha_array[],
+                                  const hipDoubleComplex* const A_array[],
+                                  const int                     lda_array[],
+                                  const hipDoubleComplex* const B_array[],
+                                  const int                     ldb_array[],
+                                  const hipDoubleComplex        beta_array[],
+                                  hipDoubleComplex* const       C_array[],
+                                  const int                     ldc_array[],
+                                  int                           groupCount,
+                                  const int                     groupSize[]);
+
+// 64-bit interface
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSgemmGroupedBatched_64(hipblasHandle_t          handle,
+                                  const hipblasOperation_t transA_array[],
+                                  const hipblasOperation_t transB_array[],
+                                  const int64_t            m_array[],
+                                  const int64_t            n_array[],
+                                  const int64_t            k_array[],
+                                  const float              alpha_array[],
+                                  const float* const       A_array[],
+                                  const int64_t            lda_array[],
+                                  const float* const       B_array[],
+                                  const int64_t            ldb_array[],
+                                  const float              beta_array[],
+                                  float* const             C_array[],
+                                  const int64_t            ldc_array[],
+                                  int64_t                  groupCount,
+                                  const int64_t            groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDgemmGroupedBatched_64(hipblasHandle_t          handle,
+                                  const hipblasOperation_t transA_array[],
+                                  const hipblasOperation_t transB_array[],
+                                  const int64_t            m_array[],
+                                  const int64_t            n_array[],
+                                  const int64_t            k_array[],
+                                  const double             alpha_array[],
+                                  const double* const      A_array[],
+                                  const int64_t            lda_array[],
+                                  const double* const      B_array[],
+                                  const int64_t            ldb_array[],
+                                  const double             beta_array[],
+                                  double* const            C_array[],
+                                  const int64_t            ldc_array[],
+                                  int64_t                  groupCount,
+                                  const int64_t            groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgemmGroupedBatched_64(hipblasHandle_t             handle,
+                                  const hipblasOperation_t    transA_array[],
+                                  const hipblasOperation_t    transB_array[],
+                                  const int64_t               m_array[],
+                                  const int64_t               n_array[],
+                                  const int64_t               k_array[],
+                                  const hipblasComplex        alpha_array[],
+                                  const hipblasComplex* const A_array[],
+                                  const int64_t               lda_array[],
+                                  const hipblasComplex* const B_array[],
+                                  const int64_t               ldb_array[],
+                                  const hipblasComplex        beta_array[],
+                                  hipblasComplex* const       C_array[],
+                                  const int64_t               ldc_array[],
+                                  int64_t                     groupCount,
+                                  const int64_t               groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmGroupedBatched_64(hipblasHandle_t                   handle,
+                                  const hipblasOperation_t          transA_array[],
+                                  const hipblasOperation_t          transB_array[],
+                                  const int64_t                     m_array[],
+                                  const int64_t                     n_array[],
+                                  const int64_t                     k_array[],
+                                  const hipblasDoubleComplex        alpha_array[],
+                                  const hipblasDoubleComplex* const A_array[],
+                                  const int64_t                     lda_array[],
+                                  const hipblasDoubleComplex* const B_array[],
+                                  const int64_t                     ldb_array[],
+                                  const hipblasDoubleComplex        beta_array[],
+                                  hipblasDoubleComplex* const       C_array[],
+                                  const int64_t                     ldc_array[],
+                                  int64_t                           groupCount,
+                                  const int64_t                     groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgemmGroupedBatched_v2_64(hipblasHandle_t          handle,
+                                     const hipblasOperation_t transA_array[],
+                                     const hipblasOperation_t transB_array[],
+                                     const int64_t            m_array[],
+                                     const int64_t            n_array[],
+                                     const int64_t            k_array[],
+                                     const hipComplex         alpha_array[],
+                                     const hipComplex* const  A_array[],
+                                     const int64_t            lda_array[],
+                                     const hipComplex* const  B_array[],
+                                     const int64_t            ldb_array[],
+                                     const hipComplex         beta_array[],
+                                     hipComplex* const        C_array[],
+                                     const int64_t            ldc_array[],
+                                     int64_t                  groupCount,
+                                     const int64_t            groupSize[]);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmGroupedBatched_v2_64(hipblasHandle_t               handle,
+                                     const hipblasOperation_t      transA_array[],
+                                     const hipblasOperation_t      transB_array[],
+                                     const int64_t                 m_array[],
+                                     const int64_t                 n_array[],
+                                     const int64_t                 k_array[],
+                                     const hipDoubleComplex        alpha_array[],
+                                     const hipDoubleComplex* const A_array[],
+                                     const int64_t                 lda_array[],
+                                     const hipDoubleComplex* const B_array[],
+                                     const int64_t                 ldb_array[],
+                                     const hipDoubleComplex        beta_array[],
+                                     hipDoubleComplex* const       C_array[],
+                                     const int64_t                 ldc_array[],
+                                     int64_t                       groupCount,
+                                     const int64_t                 groupSize[]);
+//! @}
+
 /*! @{
     \brief BLAS Level 3 API
 
@@ -30943,6 +31600,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t
       | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
       | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
 
+      With HIPBLAS_V2 define, the rocBLAS backend also multiplies 8-bit float matrices, on the
+      devices rocBLAS supports them on. aType and bType are each HIP_R_8F_E4M3_FNUZ or
+      HIP_R_8F_E5M2_FNUZ, cType is HIP_R_32F, HIP_R_16F or HIP_R_16BF and computeType is
+      HIPBLAS_COMPUTE_32F. The inputs are scaled by the factors set with
+      hipblasSetGemmExScales(). The OCP formats HIP_R_8F_E4M3 and HIP_R_8F_E5M2 are not supported
+      by rocBLAS.
+
+    With HIPBLAS_V2 define, hipblasGemmEx also applies the epilogue set with
+    hipblasSetGemmEpilogue() to C before returning.
+
+    On the rocBLAS backend, the GemmEx _v2 functions with one of the HIPBLAS_COMPUTE_32F_FAST_*
+    or *_PEDANTIC compute types run with the math mode that compute type implies. The math
+    mode is state of the handle, so the call sets it with hipblasSetMathMode() on entry and
+    restores the previous mode on return. Another thread calling functions on the same handle
+    at the same time sees the changed mode; use one handle per thread, as with the stream.
+
     hipblasGemmExWithFlags is also available which is identical to hipblasGemmEx
     with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
     rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
@@ -31276,6 +31949,179 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2_64(hipblasHandle_t
                                                             hipblasGemmAlgo_t    algo,
                                                             hipblasGemmFlags_t   flags);
 
+/*! \brief Set the scale factors of 8-bit float GemmEx inputs
+
+    \details
+    A GemmEx, GemmBatchedEx or GemmStridedBatchedEx call with 8-bit float A and B computes
+
+        C = alpha*(scaleA*op( A ))*(scaleB*op( B )) + beta*C,
+
+    so that matrices quantized with a per-tensor scale can be multiplied without rescaling
+    them first. Both factors are 1 for a new handle. Other types of input are not scaled.
+
+    The rocBLAS backend folds the factors into alpha, so a call with scale factors other than 1
+    returns HIPBLAS_STATUS_NOT_SUPPORTED in HIPBLAS_POINTER_MODE_DEVICE.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    scaleA      [float]
+                scale factor of A.
+    @param[in]
+    scaleB      [float]
+                scale factor of B.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmExScales(hipblasHandle_t handle,
+                                                      float           scaleA,
+                                                      float           scaleB);
+
+/*! \brief Get the scale factors of 8-bit float GemmEx inputs, see hipblasSetGemmExScales() */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmExScales(hipblasHandle_t handle,
+                                                      float*          scaleA,
+                                                      float*          scaleB);
+
+/*! \brief Activation applied by a GemmEx epilogue, see hipblasSetGemmEpilogue() */
+typedef enum
+{
+    HIPBLAS_GEMM_ACTIVATION_NONE = 0, /**< x */
+    HIPBLAS_GEMM_ACTIVATION_RELU = 1, /**< max(x, 0) */
+    HIPBLAS_GEMM_ACTIVATION_GELU
+    = 2 /**< 0.5*x*(1 + tanh(sqrt(2/pi)*(x + 0.044715*x**3))), the tanh approximation */
+} hipblasGemmActivation_t;
+
+/*! \brief Elementwise epilogue of GemmEx, see hipblasSetGemmEpilogue() */
+typedef struct hipblasGemmEpilogue_t
+{
+    hipblasGemmActivation_t activation; /**< activation applied after the bias */
+    const void*             bias; /**< vector of m elements of cType added to each column */
+    hipblasStride           strideBias; /**< stride from one bias vector to the next in a batch */
+    const void*             aux; /**< m by n matrix of cType added last, or nullptr */
+    int64_t                 ldAux; /**< leading dimension of aux */
+    hipblasStride           strideAux; /**< stride from one aux matrix to the next in a batch */
+} hipblasGemmEpilogue_t;
+
+/*! \brief Set the elementwise epilogue of GemmEx calls on a handle
+
+    \details
+    With an epilogue set, hipblasGemmEx_v2 and hipblasGemmStridedBatchedEx_v2, and their _64
+    forms, compute
+
+        C = act( alpha*op( A )*op( B ) + beta*C + bias*ones**T ) + aux,
+
+    where bias is a vector of m elements, aux an m by n matrix and act the activation, so that
+    a linear layer with its bias, activation and residual connection is a single call. Instance
+    i of a strided batched call reads bias + i*strideBias and aux + i*strideAux. A null bias or
+    aux is not added. Other GEMM functions ignore the epilogue.
+
+    bias and aux are device memory of type cType, which must be HIP_R_16F, HIP_R_16BF, HIP_R_32F
+    or HIP_R_64F; calls with other types of C return HIPBLAS_STATUS_NOT_SUPPORTED while an
+    epilogue is set. The epilogue is evaluated in float, or in double for HIP_R_64F, on the
+    product as rounded to cType. Neither rocBLAS nor cuBLAS fuses it into the GEMM, so it is one
+    more pass over C: the rocBLAS and cuBLAS backends queue the same hipBLAS kernel on the stream
+    of the handle after the GEMM, and the host backend applies it on the host.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    epilogue    [const hipblasGemmEpilogue_t*]
+                epilogue to apply, copied into the handle. nullptr, or an epilogue with no
+                activation, bias or aux, removes it.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmEpilogue(hipblasHandle_t              handle,
+                                                      const hipblasGemmEpilogue_t* epilogue);
+
+/*! \brief Get the elementwise epilogue of GemmEx calls on a handle, see hipblasSetGemmEpilogue() */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmEpilogue(hipblasHandle_t        handle,
+                                                      hipblasGemmEpilogue_t* epilogue);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmQuantizedEx multiplies int8 matrices and writes the product rescaled per row and column
+
+        C = quantize( diag(rowScale)*(op( A )*op( B ))*diag(colScale) ),
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T,
+
+    op( A ) is an m by k and op( B ) a k by n int8 matrix, and C is an m by n matrix. The product
+    is accumulated in int32, and element (i, j) of it is multiplied by rowScale[i]*colScale[j] in
+    float. For a HIP_R_16F C the result is rounded to half precision. For a HIP_R_8I C it is
+    rounded to the nearest integer, ties to even, offset by zeroPoint and saturated to
+    [-128, 127].
+
+    The call replaces a GemmEx call with an int32 C followed by a separate requantization pass.
+    The rocBLAS backend keeps the int32 product in device memory owned by the handle, allocated
+    on the first call and grown as needed; in HIPBLAS_GRAPH_CAPTURE_SAFE mode make a call of the
+    largest size before the capture starts. The cuBLAS and host backends return
+    HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ); HIPBLAS_OP_N or HIPBLAS_OP_T.
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ); HIPBLAS_OP_N or HIPBLAS_OP_T.
+    @param[in]
+    m         [int]
+              number of rows of matrices op( A ) and C.
+    @param[in]
+    n         [int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    A         device pointer storing int8 matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         device pointer storing int8 matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    rowScale  device pointer storing the m scale factors of the rows of C, or nullptr for ones.
+    @param[in]
+    colScale  device pointer storing the n scale factors of the columns of C, or nullptr for
+              ones.
+    @param[in]
+    zeroPoint [int32_t]
+              offset of the quantized values of an int8 C; must be 0 for a HIP_R_16F C.
+    @param[out]
+    C         device pointer storing matrix C.
+    @param[in]
+    cType     [hipDataType]
+              type of C, HIP_R_8I or HIP_R_16F.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmQuantizedEx(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const int8_t*      A,
+                                                      int                lda,
+                                                      const int8_t*      B,
+                                                      int                ldb,
+                                                      const float*       rowScale,
+                                                      const float*       colScale,
+                                                      int32_t            zeroPoint,
+                                                      void*              C,
+                                                      hipDataType        cType,
+                                                      int                ldc);
+
 /*! \brief BLAS EX API
     \details
     gemmBatchedEx performs one of the batched matrix-matrix operations
@@ -31678,6 +32524,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2_64(hipblasHandle
     longer support hipblasDataType_t for these parameters in a future release. hipblasGemmStridedBatchedExWithFlags
     follows the same convention.
 
+    With HIPBLAS_V2 define, hipblasGemmStridedBatchedEx also applies the epilogue set with
+    hipblasSetGemmEpilogue() to each C before returning.
+
         #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
 
             hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t      handle,
@@ -32066,6 +32915,445 @@ HIPBLAS_EXPORT hipblasStatus_t
                                                hipblasGemmAlgo_t    algo,
                                                hipblasGemmFlags_t   flags);
 
+/*! \brief BLAS EX API
+
+    \details
+    gemmGroupedBatchedEx performs groupCount batched matrix-matrix operations, each group with its
+    own sizes, operations and scalars:
+
+        C_i = alpha_g*op_g( A_i )*op_g( B_i ) + beta_g*C_i, for the groupSize[g] instances i of group g,
+
+    where op_g( X ) is one of
+
+        op_g( X ) = X      or
+        op_g( X ) = X**T   or
+        op_g( X ) = X**H,
+
+    as given by transA_array[g] and transB_array[g], op_g( A_i ) is an m_array[g] by k_array[g] matrix,
+    op_g( B_i ) a k_array[g] by n_array[g] matrix and C_i an m_array[g] by n_array[g] matrix. The
+    data and compute types are shared by all groups.
+
+    The instances of all groups are stored one group after the other in A_array, B_array and C_array,
+    which hold groupSize[0] + ... + groupSize[groupCount - 1] device pointers each. All other arrays
+    have groupCount entries and are in host memory, except alpha_array and beta_array which follow
+    the pointer mode of the handle and hold scalars of the type used by hipblasGemmEx for the same
+    types.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    With the cuBLAS backend the call maps to cublasGemmGroupedBatchedEx from CUDA 12.5 on when the
+    pointer mode is host; otherwise, and with the rocBLAS backend, the groups are issued one after the
+    other as batched GEMMs on the stream of the handle, with the data types resolved once per call.
+
+    With HIPBLAS_V2 define, hipblasGemmGroupedBatchedEx accepts hipDataType for aType, bType, and cType
+    and hipblasComputeType_t for computeType, as hipblasGemmBatchedEx does.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA_array [hipblasOperation_t]
+              host array of groupCount operations op( A ).
+    @param[in]
+    transB_array [hipblasOperation_t]
+              host array of groupCount operations op( B ).
+    @param[in]
+    m_array   [int]
+              host array of groupCount matrix dimensions m.
+    @param[in]
+    n_array   [int]
+              host array of groupCount matrix dimensions n.
+    @param[in]
+    k_array   [int]
+              host array of groupCount matrix dimensions k.
+    @param[in]
+    alpha_array
+              [const void *]
+              device array or host array of groupCount scalars alpha.
+    @param[in]
+    A_array   [void *]
+              device array of device pointers storing each matrix A_i.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda_array [int]
+              host array of groupCount leading dimensions of the A_i.
+    @param[in]
+    B_array   [void *]
+              device array of device pointers storing each matrix B_i.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb_array [int]
+              host array of groupCount leading dimensions of the B_i.
+    @param[in]
+    beta_array
+              [const void *]
+              device array or host array of groupCount scalars beta.
+    @param[in, out]
+    C_array   [void *]
+              device array of device pointers storing each matrix C_i.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc_array [int]
+              host array of groupCount leading dimensions of the C_i.
+    @param[in]
+    groupCount
+              [int]
+              number of groups.
+    @param[in]
+    groupSize [int]
+              host array of groupCount numbers of gemm operations in each group.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
+     ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t transA_array[],
+                                                           const hipblasOperation_t transB_array[],
+                                                           const int                m_array[],
+                                                           const int                n_array[],
+                                                           const int                k_array[],
+                                                           const void*              alpha_array,
+                                                           const void* const        A_array[],
+                                                           hipblasDatatype_t        aType,
+                                                           const int                lda_array[],
+                                                           const void* const        B_array[],
+                                                           hipblasDatatype_t        bType,
+                                                           const int                ldb_array[],
+                                                           const void*              beta_array,
+                                                           void* const              C_array[],
+                                                           hipblasDatatype_t        cType,
+                                                           const int                ldc_array[],
+                                                           int                      groupCount,
+                                                           const int                groupSize[],
+                                                           hipblasDatatype_t        computeType);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmGroupedBatchedEx_v2(hipblasHandle_t          handle,
+                                   const hipblasOperation_t transA_array[],
+                                   const hipblasOperation_t transB_array[],
+                                   const int                m_array[],
+                                   const int                n_array[],
+                                   const int                k_array[],
+                                   const void*              alpha_array,
+                                   const void* const        A_array[],
+                                   hipDataType              aType,
+                                   const int                lda_array[],
+                                   const void* const        B_array[],
+                                   hipDataType              bType,
+                                   const int                ldb_array[],
+                                   const void*              beta_array,
+                                   void* const              C_array[],
+                                   hipDataType              cType,
+                                   const int                ldc_array[],
+                                   int                      groupCount,
+                                   const int                groupSize[],
+                                   hipblasComputeType_t     computeType);
+
+// 64-bit interface
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmGroupedBatchedEx_64(hipblasHandle_t          handle,
+                                   const hipblasOperation_t transA_array[],
+                                   const hipblasOperation_t transB_array[],
+                                   const int64_t            m_array[],
+                                   const int64_t            n_array[],
+                                   const int64_t            k_array[],
+                                   const void*              alpha_array,
+                                   const void* const        A_array[],
+                                   hipblasDatatype_t        aType,
+                                   const int64_t            lda_array[],
+                                   const void* const        B_array[],
+                                   hipblasDatatype_t        bType,
+                                   const int64_t            ldb_array[],
+                                   const void*              beta_array,
+                                   void* const              C_array[],
+                                   hipblasDatatype_t        cType,
+                                   const int64_t            ldc_array[],
+                                   int64_t                  groupCount,
+                                   const int64_t            groupSize[],
+                                   hipblasDatatype_t        computeType);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmGroupedBatchedEx_v2_64(hipblasHandle_t          handle,
+                                      const hipblasOperation_t transA_array[],
+                                      const hipblasOperation_t transB_array[],
+                                      const int64_t            m_array[],
+                                      const int64_t            n_array[],
+                                      const int64_t            k_array[],
+                                      const void*              alpha_array,
+                                      const void* const        A_array[],
+                                      hipDataType              aType,
+                                      const int64_t            lda_array[],
+                                      const void* const        B_array[],
+                                      hipDataType              bType,
+                                      const int64_t            ldb_array[],
+                                      const void*              beta_array,
+                                      void* const              C_array[],
+                                      hipDataType              cType,
+                                      const int64_t            ldc_array[],
+                                      int64_t                  groupCount,
+                                      const int64_t            groupSize[],
+                                      hipblasComputeType_t     computeType);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmBatchedExWithScalarStride and gemmStridedBatchedExWithScalarStride perform the batched
+    and strided-batched matrix-matrix operations with a scalar pair per instance
+
+        C_i = alpha_i*op( A_i )*op( B_i ) + beta_i*C_i, for i = 0, ..., batchCount - 1,
+
+    where alpha_i = alpha[i*strideAlpha] and beta_i = beta[i*strideBeta]. alpha and beta follow
+    the pointer mode of the handle and hold scalars of the type used by hipblasGemmEx for the same
+    types. The strides are in scalars; a stride of 0 gives every instance the same scalar, and with
+    both strides 0 the functions are identical to hipblasGemmBatchedEx and
+    hipblasGemmStridedBatchedEx. All other arguments are those of hipblasGemmBatchedEx and
+    hipblasGemmStridedBatchedEx.
+
+    Neither rocBLAS nor cuBLAS take a scalar per instance, so with host scalars the batch is issued
+    as batched GEMMs on the stream of the handle, one per run of consecutive instances that share
+    their scalars, found by comparing the scalars. Device scalars are not read on the host. On the
+    rocBLAS and cuBLAS backends, for a C of type HIP_R_16F, HIP_R_16BF, HIP_R_32F or HIP_R_64F and
+    no epilogue set with hipblasSetGemmEpilogue, the products of the whole batch are computed by
+    one batched GEMM into device memory, owned by the handle on rocBLAS and allocated in the
+    order of the stream on cuBLAS, and a hipBLAS kernel then scales them by alpha_i and adds them
+    to beta_i*C_i. The products are kept in the type of the scalars, so a 16-bit C with float
+    scalars is rounded once, as by a single GEMM. The host backend does the same for a float or
+    double C, with the products in host memory. Otherwise, or where the handle may not allocate
+    that memory, each instance is issued on its own. Each of these GEMMs is logged as the batched
+    GEMM it is.
+
+    With HIPBLAS_V2 define, these functions accept hipDataType for aType, bType, and cType and
+    hipblasComputeType_t for computeType, as hipblasGemmBatchedEx does.
+
+    @param[in]
+    alpha     [const void *]
+              device array or host array of scalars alpha, at least
+              (batchCount - 1)*strideAlpha + 1 scalars long.
+    @param[in]
+    strideAlpha
+              [hipblasStride]
+              stride in scalars from alpha_i to alpha_(i + 1). Must be 0 or more.
+    @param[in]
+    beta      [const void *]
+              device array or host array of scalars beta, at least
+              (batchCount - 1)*strideBeta + 1 scalars long.
+    @param[in]
+    strideBeta
+              [hipblasStride]
+              stride in scalars from beta_i to beta_(i + 1). Must be 0 or more.
+     ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithScalarStride(hipblasHandle_t    handle,
+                                                                    hipblasOperation_t transA,
+                                                                    hipblasOperation_t transB,
+                                                                    int                m,
+                                                                    int                n,
+                                                                    int                k,
+                                                                    const void*        alpha,
+                                                                    hipblasStride      strideAlpha,
+                                                                    const void*        A[],
+                                                                    hipblasDatatype_t  aType,
+                                                                    int                lda,
+                                                                    const void*        B[],
+                                                                    hipblasDatatype_t  bType,
+                                                                    int                ldb,
+                                                                    const void*        beta,
+                                                                    hipblasStride      strideBeta,
+                                                                    void*              C[],
+                                                                    hipblasDatatype_t  cType,
+                                                                    int                ldc,
+                                                                    int                batchCount,
+                                                                    hipblasDatatype_t  computeType,
+                                                                    hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmBatchedExWithScalarStride_v2(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transA,
+                                            hipblasOperation_t   transB,
+                                            int                  m,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            hipblasStride        strideAlpha,
+                                            const void*          A[],
+                                            hipDataType          aType,
+                                            int                  lda,
+                                            const void*          B[],
+                                            hipDataType          bType,
+                                            int                  ldb,
+                                            const void*          beta,
+                                            hipblasStride        strideBeta,
+                                            void*                C[],
+                                            hipDataType          cType,
+                                            int                  ldc,
+                                            int                  batchCount,
+                                            hipblasComputeType_t computeType,
+                                            hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmBatchedExWithScalarStride_64(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int64_t            m,
+                                            int64_t            n,
+                                            int64_t            k,
+                                            const void*        alpha,
+                                            hipblasStride      strideAlpha,
+                                            const void*        A[],
+                                            hipblasDatatype_t  aType,
+                                            int64_t            lda,
+                                            const void*        B[],
+                                            hipblasDatatype_t  bType,
+                                            int64_t            ldb,
+                                            const void*        beta,
+                                            hipblasStride      strideBeta,
+                                            void*              C[],
+                                            hipblasDatatype_t  cType,
+                                            int64_t            ldc,
+                                            int64_t            batchCount,
+                                            hipblasDatatype_t  computeType,
+                                            hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmBatchedExWithScalarStride_v2_64(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transA,
+                                               hipblasOperation_t   transB,
+                                               int64_t              m,
+                                               int64_t              n,
+                                               int64_t              k,
+                                               const void*          alpha,
+                                               hipblasStride        strideAlpha,
+                                               const void*          A[],
+                                               hipDataType          aType,
+                                               int64_t              lda,
+                                               const void*          B[],
+                                               hipDataType          bType,
+                                               int64_t              ldb,
+                                               const void*          beta,
+                                               hipblasStride        strideBeta,
+                                               void*                C[],
+                                               hipDataType          cType,
+                                               int64_t              ldc,
+                                               int64_t              batchCount,
+                                               hipblasComputeType_t computeType,
+                                               hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithScalarStride(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const void*        alpha,
+                                                hipblasStride      strideAlpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  aType,
+                                                int                lda,
+                                                hipblasStride      strideA,
+                                                const void*        B,
+                                                hipblasDatatype_t  bType,
+                                                int                ldb,
+                                                hipblasStride      strideB,
+                                                const void*        beta,
+                                                hipblasStride      strideBeta,
+                                                void*              C,
+                                                hipblasDatatype_t  cType,
+                                                int                ldc,
+                                                hipblasStride      strideC,
+                                                int                batchCount,
+                                                hipblasDatatype_t  computeType,
+                                                hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithScalarStride_v2(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transA,
+                                                   hipblasOperation_t   transB,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   hipblasStride        strideAlpha,
+                                                   const void*          A,
+                                                   hipDataType          aType,
+                                                   int                  lda,
+                                                   hipblasStride        strideA,
+                                                   const void*          B,
+                                                   hipDataType          bType,
+                                                   int                  ldb,
+                                                   hipblasStride        strideB,
+                                                   const void*          beta,
+                                                   hipblasStride        strideBeta,
+                                                   void*                C,
+                                                   hipDataType          cType,
+                                                   int                  ldc,
+                                                   hipblasStride        strideC,
+                                                   int                  batchCount,
+                                                   hipblasComputeType_t computeType,
+                                                   hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithScalarStride_64(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int64_t            m,
+                                                   int64_t            n,
+                                                   int64_t            k,
+                                                   const void*        alpha,
+                                                   hipblasStride      strideAlpha,
+                                                   const void*        A,
+                                                   hipblasDatatype_t  aType,
+                                                   int64_t            lda,
+                                                   hipblasStride      strideA,
+                                                   const void*        B,
+                                                   hipblasDatatype_t  bType,
+                                                   int64_t            ldb,
+                                                   hipblasStride      strideB,
+                                                   const void*        beta,
+                                                   hipblasStride      strideBeta,
+                                                   void*              C,
+                                                   hipblasDatatype_t  cType,
+                                                   int64_t            ldc,
+                                                   hipblasStride      strideC,
+                                                   int64_t            batchCount,
+                                                   hipblasDatatype_t  computeType,
+                                                   hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithScalarStride_v2_64(hipblasHandle_t      handle,
+                                                      hipblasOperation_t   transA,
+                                                      hipblasOperation_t   transB,
+                                                      int64_t              m,
+                                                      int64_t              n,
+                                                      int64_t              k,
+                                                      const void*          alpha,
+                                                      hipblasStride        strideAlpha,
+                                                      const void*          A,
+                                                      hipDataType          aType,
+                                                      int64_t              lda,
+                                                      hipblasStride        strideA,
+                                                      const void*          B,
+                                                      hipDataType          bType,
+                                                      int64_t              ldb,
+                                                      hipblasStride        strideB,
+                                                      const void*          beta,
+                                                      hipblasStride        strideBeta,
+                                                      void*                C,
+                                                      hipDataType          cType,
+                                                      int64_t              ldc,
+                                                      hipblasStride        strideC,
+                                                      int64_t              batchCount,
+                                                      hipblasComputeType_t computeType,
+                                                      hipblasGemmAlgo_t    algo);
+
 /*! BLAS EX API
 
     \details
@@ -35012,6 +36300,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasGemmBatchedExWithFlags_64 hipblasGemmBatchedExWithFlags_v2_64
 #define hipblasGemmStridedBatchedExWithFlags_64 hipblasGemmStridedBatchedExWithFlags_v2_64
 
+#define hipblasGemmGroupedBatchedEx hipblasGemmGroupedBatchedEx_v2
+#define hipblasGemmGroupedBatchedEx_64 hipblasGemmGroupedBatchedEx_v2_64
+
+#define hipblasGemmBatchedExWithScalarStride hipblasGemmBatchedExWithScalarStride_v2
+#define hipblasGemmStridedBatchedExWithScalarStride hipblasGemmStridedBatchedExWithScalarStride_v2
+#define hipblasGemmBatchedExWithScalarStride_64 hipblasGemmBatchedExWithScalarStride_v2_64
+#define hipblasGemmStridedBatchedExWithScalarStride_64 \
+    hipblasGemmStridedBatchedExWithScalarStride_v2_64
+
 #define hipblasAxpyEx hipblasAxpyEx_v2
 #define hipblasAxpyBatchedEx hipblasAxpyBatchedEx_v2
 #define hipblasAxpyStridedBatchedEx hipblasAxpyStridedBatchedEx_v2
@@ -35647,6 +36944,10 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasZgemmBatched_64 hipblasZgemmBatched_v2_64
 #define hipblasCgemmStridedBatched_64 hipblasCgemmStridedBatched_v2_64
 #define hipblasZgemmStridedBatched_64 hipblasZgemmStridedBatched_v2_64
+#define hipblasCgemmGroupedBatched hipblasCgemmGroupedBatched_v2
+#define hipblasZgemmGroupedBatched hipblasZgemmGroupedBatched_v2
+#define hipblasCgemmGroupedBatched_64 hipblasCgemmGroupedBatched_v2_64
+#define hipblasZgemmGroupedBatched_64 hipblasZgemmGroupedBatched_v2_64
 
 #define hipblasCherk hipblasCherk_v2
 #define hipblasZherk hipblasZherk_v2
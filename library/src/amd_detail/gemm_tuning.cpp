@@ -0,0 +1,1066 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// The solution query functions are part of the rocBLAS beta API
+#define ROCBLAS_BETA_FEATURES_API
+#define ROCBLAS_NO_DEPRECATED_WARNINGS
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_tuning.hpp"
+#include "handle_state.hpp"
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    bool hipblas_read_gemm_tuning()
+    {
+        const char* env = getenv("HIPBLAS_GEMM_TUNING");
+        return env && *env && strtol(env, nullptr, 0) != 0;
+    }
+
+    // Timed runs of each solution, after one untimed run
+    constexpr int hipblas_gemm_tuning_runs = 3;
+
+    enum hipblasGemmTuneRoutine : int64_t
+    {
+        hipblas_tune_gemm_ex,
+        hipblas_tune_gemm_batched_ex,
+        hipblas_tune_gemm_strided_batched_ex,
+    };
+
+    // Device, routine, operations, sizes, leading dimensions, types, flags, batch count,
+    // broadcast operands and math mode of a GEMM; pointers, strides and scalars do not change
+    // which solution is fastest
+    using hipblasGemmTuneKey = std::array<int64_t, 20>;
+
+    // Math mode the handle runs the GEMM with, which GemmEx sets from its compute type for the
+    // duration of the call; solutions tuned with xf32 do not apply to full precision
+    int64_t hipblasGemmTuneMathMode(rocblas_handle handle)
+    {
+        rocblas_math_mode mode;
+        return rocblas_get_math_mode(handle, &mode) == rocblas_status_success
+                   ? mode
+                   : rocblas_default_math;
+    }
+
+    struct hipblasGemmTuneKeyHash
+    {
+        size_t operator()(const hipblasGemmTuneKey& key) const
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for(int64_t value : key)
+                hash = (hash ^ uint64_t(value)) * 0x100000001b3ull;
+            return size_t(hash);
+        }
+    };
+
+    using hipblasGemmTuneTable
+        = std::unordered_map<hipblasGemmTuneKey, int32_t, hipblasGemmTuneKeyHash>;
+
+    // Solution chosen for each problem seen, or -1 to keep the default. Shared by all handles;
+    // never destroyed, so it stays usable during static destruction.
+    struct hipblasGemmTuneCache
+    {
+        std::shared_mutex    mutex;
+        hipblasGemmTuneTable solutions;
+    };
+
+    hipblasGemmTuneCache& hipblasGetGemmTuneCache()
+    {
+        static hipblasGemmTuneCache* cache = new hipblasGemmTuneCache;
+        return *cache;
+    }
+
+    std::atomic<bool> hipblas_gemm_tuning{hipblas_read_gemm_tuning()};
+
+    // Solutions read from HIPBLAS_GEMM_TUNING_DB, keyed by the devices they apply to. Set once
+    // and never modified or freed, so it is read without a lock.
+    std::atomic<const hipblasGemmTuneTable*> hipblas_gemm_tuning_db{nullptr};
+
+    bool hipblasGemmTuningActive()
+    {
+        return hipblas_gemm_tuning.load(std::memory_order_relaxed)
+               || hipblas_gemm_tuning_db.load(std::memory_order_relaxed);
+    }
+
+    // First line of a tuning database, followed by one line per problem holding the
+    // architecture, the key without its device, and the solution. Version 1 lines have no
+    // math mode and are read as tuned with the default one.
+    constexpr char hipblas_gemm_tuning_db_header[]  = "# hipBLAS GEMM tuning database 2";
+    constexpr char hipblas_gemm_tuning_db_header1[] = "# hipBLAS GEMM tuning database 1";
+
+    // Architecture name of a device without its feature flags, e.g. gfx90a, or "" on failure
+    std::string hipblasDeviceArch(int device)
+    {
+        hipDeviceProp_t prop;
+        if(hipGetDeviceProperties(&prop, device) != hipSuccess)
+            return "";
+        std::string arch = prop.gcnArchName;
+        return arch.substr(0, arch.find(':'));
+    }
+
+    const hipblasGemmTuneTable* hipblasReadGemmTuningDatabase(const char* path)
+    {
+        FILE* file = fopen(path, "r");
+        if(!file)
+        {
+            fprintf(stderr, "hipBLAS: cannot open HIPBLAS_GEMM_TUNING_DB=%s\n", path);
+            return nullptr;
+        }
+
+        int count;
+        if(hipGetDeviceCount(&count) != hipSuccess)
+            count = 0;
+        std::vector<std::string> archs;
+        for(int device = 0; device < count; device++)
+            archs.push_back(hipblasDeviceArch(device));
+
+        auto*  table = new hipblasGemmTuneTable;
+        char   line[1024];
+        size_t number = 0;
+        bool   valid  = fgets(line, sizeof(line), file);
+        bool   math   = valid
+                     && !strncmp(line,
+                                 hipblas_gemm_tuning_db_header,
+                                 sizeof(hipblas_gemm_tuning_db_header) - 1);
+        valid = math
+                || (valid
+                    && !strncmp(line,
+                                hipblas_gemm_tuning_db_header1,
+                                sizeof(hipblas_gemm_tuning_db_header1) - 1));
+        while(valid && fgets(line, sizeof(line), file))
+        {
+            number++;
+            if(line[0] == '#' || line[0] == '\n')
+                continue;
+
+            hipblasGemmTuneKey key{};
+            char               arch[64];
+            long long          solution;
+            int                offset;
+            const char*        next = line;
+            valid = sscanf(next, "%63s%n", arch, &offset) == 1;
+            for(size_t i = 1; valid && i < key.size() - !math; i++)
+            {
+                long long value;
+                next += offset;
+                valid  = sscanf(next, "%lld%n", &value, &offset) == 1;
+                key[i] = value;
+            }
+            if(!math)
+                key.back() = rocblas_default_math;
+            next += offset;
+            valid = valid && sscanf(next, "%lld", &solution) == 1;
+
+            for(int device = 0; valid && device < count; device++)
+            {
+                key[0] = device;
+                if(archs[device] == arch)
+                    (*table)[key] = int32_t(solution);
+            }
+        }
+        fclose(file);
+
+        if(!valid)
+        {
+            fprintf(stderr,
+                    "hipBLAS: HIPBLAS_GEMM_TUNING_DB=%s is not a tuning database (line %zu)\n",
+                    path,
+                    number + 1);
+            delete table;
+            return nullptr;
+        }
+        return table;
+    }
+
+    bool hipblasFindGemmSolution(const hipblasGemmTuneKey& key, int32_t& solution)
+    {
+        hipblasGemmTuneCache&               cache = hipblasGetGemmTuneCache();
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+
+        auto it = cache.solutions.find(key);
+        if(it == cache.solutions.end())
+            return false;
+        solution = it->second;
+        return true;
+    }
+
+    void hipblasStoreGemmSolution(const hipblasGemmTuneKey& key, int32_t solution)
+    {
+        hipblasGemmTuneCache&               cache = hipblasGetGemmTuneCache();
+        std::unique_lock<std::shared_mutex> lock(cache.mutex);
+        cache.solutions[key] = solution;
+    }
+
+    // Tuning allocates device memory and waits for the timed runs, which a handle in graph
+    // capture safe mode, or a stream being captured, does not allow. In a device memory size
+    // query the runs return without running, so their times would mean nothing.
+    bool hipblasMayTune(rocblas_handle handle)
+    {
+        if(hipblasGetHandleState(hipblasHandle_t(handle))->graph_capture_mode
+               == HIPBLAS_GRAPH_CAPTURE_SAFE
+           || rocblas_is_device_memory_size_query(handle))
+            return false;
+
+        hipStream_t            stream;
+        hipStreamCaptureStatus capture;
+        return rocblas_get_stream(handle, &stream) == rocblas_status_success
+               && hipStreamIsCapturing(stream, &capture) == hipSuccess
+               && capture == hipStreamCaptureStatusNone;
+    }
+
+    bool hipblasIs8BitFloat(rocblas_datatype type)
+    {
+        return type == rocblas_datatype_f8_r || type == rocblas_datatype_bf8_r;
+    }
+
+    /*! \brief Fold the scale factors set with hipblasSetGemmExScales into alpha.
+     *
+     *  rocBLAS takes no per-tensor scale factors for 8-bit float inputs, so alpha is multiplied
+     *  by them instead, and points to scaled afterwards. That needs alpha on the host: returns
+     *  false if the factors are not 1 and the handle is in device pointer mode.
+     */
+    bool hipblasScaleGemmAlpha(rocblas_handle handle, const void*& alpha, float& scaled)
+    {
+        hipblasHandleState* state = hipblasGetHandleState(hipblasHandle_t(handle));
+        float               scale = state->gemm_ex_scale_a.load() * state->gemm_ex_scale_b.load();
+        if(scale == 1.0f)
+            return true;
+
+        rocblas_pointer_mode mode;
+        if(rocblas_get_pointer_mode(handle, &mode) != rocblas_status_success
+           || mode != rocblas_pointer_mode_host)
+            return false;
+
+        if(alpha)
+        {
+            scaled = *static_cast<const float*>(alpha) * scale;
+            alpha  = &scaled;
+        }
+        return true;
+    }
+
+    size_t hipblasDatatypeSize(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_u8_r:
+        case rocblas_datatype_f8_r:
+        case rocblas_datatype_bf8_r:
+            return 1;
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_i8_c:
+        case rocblas_datatype_u8_c:
+            return 2;
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_i32_r:
+        case rocblas_datatype_u32_r:
+        case rocblas_datatype_f16_c:
+        case rocblas_datatype_bf16_c:
+            return 4;
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_i32_c:
+        case rocblas_datatype_u32_c:
+            return 8;
+        case rocblas_datatype_f64_c:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Device memory released when it goes out of scope; ptr is nullptr if allocation failed
+    struct hipblasTuneBuffer
+    {
+        void* ptr = nullptr;
+
+        explicit hipblasTuneBuffer(size_t bytes)
+        {
+            if(hipMalloc(&ptr, bytes) != hipSuccess)
+                ptr = nullptr;
+        }
+
+        ~hipblasTuneBuffer()
+        {
+            if(ptr)
+                (void)hipFree(ptr);
+        }
+
+        hipblasTuneBuffer(const hipblasTuneBuffer&) = delete;
+        hipblasTuneBuffer& operator=(const hipblasTuneBuffer&) = delete;
+    };
+
+    /*! \brief Time run(solution) for each of solutions on the stream of handle.
+     *
+     *  Returns the fastest solution, or -1 if none of them ran. Solutions which fail, for
+     *  example because they need more device memory than the handle holds, are skipped.
+     */
+    template <typename Run>
+    int32_t hipblasFastestGemmSolution(rocblas_handle                  handle,
+                                       const std::vector<rocblas_int>& solutions,
+                                       Run&&                           run)
+    {
+        hipStream_t stream;
+        hipEvent_t  start, stop;
+        if(rocblas_get_stream(handle, &stream) != rocblas_status_success
+           || hipEventCreate(&start) != hipSuccess)
+            return -1;
+        if(hipEventCreate(&stop) != hipSuccess)
+        {
+            (void)hipEventDestroy(start);
+            return -1;
+        }
+
+        int32_t fastest      = -1;
+        float   fastest_time = std::numeric_limits<float>::max();
+        for(rocblas_int solution : solutions)
+        {
+            if(run(solution) != rocblas_status_success)
+                continue;
+
+            bool  ran = hipEventRecord(start, stream) == hipSuccess;
+            float time;
+            for(int i = 0; ran && i < hipblas_gemm_tuning_runs; i++)
+                ran = run(solution) == rocblas_status_success;
+            if(ran && hipEventRecord(stop, stream) == hipSuccess
+               && hipEventSynchronize(stop) == hipSuccess
+               && hipEventElapsedTime(&time, start, stop) == hipSuccess && time < fastest_time)
+            {
+                fastest      = solution;
+                fastest_time = time;
+            }
+        }
+
+        (void)hipEventDestroy(start);
+        (void)hipEventDestroy(stop);
+        return fastest;
+    }
+
+    /*! \brief Solution to run the GEMM identified by key with.
+     *
+     *  On the first call for key, get_solutions(list, size) lists the candidates and
+     *  run(solution, scratch) runs the GEMM writing its result to scratch, scratch_bytes of
+     *  device memory set up by prepare(scratch), so the operands of the call are left
+     *  untouched. Returns -1 to run the default solution.
+     */
+    template <typename GetSolutions, typename Prepare, typename Run>
+    int32_t hipblasGemmSolution(rocblas_handle            handle,
+                                const hipblasGemmTuneKey& key,
+                                size_t                    scratch_bytes,
+                                GetSolutions&&            get_solutions,
+                                Prepare&&                 prepare,
+                                Run&&                     run)
+    {
+        const hipblasGemmTuneTable* db = hipblas_gemm_tuning_db.load(std::memory_order_acquire);
+        if(db)
+        {
+            auto it = db->find(key);
+            if(it != db->end())
+                return it->second;
+        }
+
+        int32_t solution;
+        if(!hipblas_gemm_tuning.load(std::memory_order_relaxed))
+            return -1;
+        if(hipblasFindGemmSolution(key, solution))
+            return solution;
+        if(!scratch_bytes || !hipblasMayTune(handle))
+            return -1;
+
+        solution         = -1;
+        rocblas_int size = 0;
+        if(get_solutions(nullptr, &size) == rocblas_status_success && size > 0)
+        {
+            std::vector<rocblas_int> solutions(size);
+            hipblasTuneBuffer        scratch(scratch_bytes);
+            if(scratch.ptr && prepare(scratch.ptr)
+               && get_solutions(solutions.data(), &size) == rocblas_status_success)
+            {
+                solutions.resize(size);
+                solution = hipblasFastestGemmSolution(
+                    handle, solutions, [&](rocblas_int s) { return run(s, scratch.ptr); });
+            }
+        }
+
+        hipblasStoreGemmSolution(key, solution);
+        return solution;
+    }
+}
+
+void hipblasLoadGemmTuningDatabase()
+{
+    static std::once_flag once;
+    std::call_once(once, [] {
+        const char* path = getenv("HIPBLAS_GEMM_TUNING_DB");
+        if(path && *path)
+            hipblas_gemm_tuning_db.store(hipblasReadGemmTuningDatabase(path),
+                                         std::memory_order_release);
+    });
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGemmTuning(int enable)
+try
+{
+    hipblas_gemm_tuning.store(enable != 0, std::memory_order_relaxed);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSaveGemmTuning(const char* path)
+try
+{
+    if(!path)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // One line per architecture and problem. Devices of the same architecture share their
+    // entries, and solutions tuned in this process replace those read from
+    // HIPBLAS_GEMM_TUNING_DB.
+    hipblasLoadGemmTuningDatabase();
+    std::unordered_map<int64_t, std::string> archs;
+    std::unordered_map<std::string, int32_t> lines;
+    auto add = [&](const hipblasGemmTuneTable& solutions) {
+        for(const auto& entry : solutions)
+        {
+            const hipblasGemmTuneKey& key  = entry.first;
+            auto                      arch = archs.find(key[0]);
+            if(arch == archs.end())
+                arch = archs.emplace(key[0], hipblasDeviceArch(int(key[0]))).first;
+            if(entry.second < 0 || arch->second.empty())
+                continue;
+
+            std::string line = arch->second;
+            for(size_t i = 1; i < key.size(); i++)
+                line += " " + std::to_string(key[i]);
+            lines.emplace(line, entry.second);
+        }
+    };
+    {
+        hipblasGemmTuneCache&               cache = hipblasGetGemmTuneCache();
+        std::shared_lock<std::shared_mutex> lock(cache.mutex);
+        add(cache.solutions);
+    }
+    if(const hipblasGemmTuneTable* db = hipblas_gemm_tuning_db.load(std::memory_order_acquire))
+        add(*db);
+
+    FILE* file = fopen(path, "w");
+    if(!file)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool written = fprintf(file, "%s\n", hipblas_gemm_tuning_db_header) > 0;
+    for(const auto& line : lines)
+        written = written && fprintf(file, "%s %d\n", line.first.c_str(), line.second) > 0;
+
+    if(fclose(file) || !written)
+        return HIPBLAS_STATUS_UNKNOWN;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+rocblas_status hipblasTunedGemmEx(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  const void*       alpha,
+                                  const void*       a,
+                                  rocblas_datatype  a_type,
+                                  rocblas_int       lda,
+                                  const void*       b,
+                                  rocblas_datatype  b_type,
+                                  rocblas_int       ldb,
+                                  const void*       beta,
+                                  const void*       c,
+                                  rocblas_datatype  c_type,
+                                  rocblas_int       ldc,
+                                  void*             d,
+                                  rocblas_datatype  d_type,
+                                  rocblas_int       ldd,
+                                  rocblas_datatype  compute_type,
+                                  rocblas_gemm_algo algo,
+                                  int32_t           solution_index,
+                                  uint32_t          flags)
+{
+    // rocBLAS multiplies 8-bit floats through its ex3 API, which takes a compute type of its own
+    // and has no solutions to tune
+    if(hipblasIs8BitFloat(a_type) || hipblasIs8BitFloat(b_type))
+    {
+        float alpha_scaled;
+        if(!hipblasScaleGemmAlpha(handle, alpha, alpha_scaled))
+            return rocblas_status_not_implemented;
+
+        return rocblas_gemm_ex3(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                a,
+                                a_type,
+                                lda,
+                                b,
+                                b_type,
+                                ldb,
+                                beta,
+                                c,
+                                c_type,
+                                ldc,
+                                d,
+                                d_type,
+                                ldd,
+                                rocblas_compute_type_f32,
+                                algo,
+                                solution_index,
+                                flags);
+    }
+
+    int device;
+    if(hipblasGemmTuningActive() && algo == rocblas_gemm_algo_standard && solution_index == 0
+       && m > 0 && n > 0 && ldd >= m && hipGetDevice(&device) == hipSuccess)
+    {
+        hipblasGemmTuneKey key{device,
+                               hipblas_tune_gemm_ex,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               a_type,
+                               lda,
+                               b_type,
+                               ldb,
+                               c_type,
+                               ldc,
+                               d_type,
+                               ldd,
+                               compute_type,
+                               flags,
+                               1,
+                               0,
+                               hipblasGemmTuneMathMode(handle)};
+
+        auto get_solutions = [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_ex_get_solutions(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 a,
+                                                 a_type,
+                                                 lda,
+                                                 b,
+                                                 b_type,
+                                                 ldb,
+                                                 beta,
+                                                 c,
+                                                 c_type,
+                                                 ldc,
+                                                 d,
+                                                 d_type,
+                                                 ldd,
+                                                 compute_type,
+                                                 rocblas_gemm_algo_solution_index,
+                                                 flags,
+                                                 list,
+                                                 size);
+        };
+        auto run = [&](rocblas_int solution, void* d_run) {
+            return rocblas_gemm_ex(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   a,
+                                   a_type,
+                                   lda,
+                                   b,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   c,
+                                   c_type,
+                                   ldc,
+                                   d_run,
+                                   d_type,
+                                   ldd,
+                                   compute_type,
+                                   rocblas_gemm_algo_solution_index,
+                                   solution,
+                                   flags);
+        };
+
+        size_t  d_bytes  = size_t(ldd) * n * hipblasDatatypeSize(d_type);
+        int32_t solution = hipblasGemmSolution(
+            handle, key, d_bytes, get_solutions, [](void*) { return true; }, run);
+        if(solution >= 0)
+            return run(solution, d);
+    }
+
+    return rocblas_gemm_ex(handle,
+                           transA,
+                           transB,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           a,
+                           a_type,
+                           lda,
+                           b,
+                           b_type,
+                           ldb,
+                           beta,
+                           c,
+                           c_type,
+                           ldc,
+                           d,
+                           d_type,
+                           ldd,
+                           compute_type,
+                           algo,
+                           solution_index,
+                           flags);
+}
+
+rocblas_status hipblasTunedGemmBatchedEx(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const void*       alpha,
+                                         const void*       a,
+                                         rocblas_datatype  a_type,
+                                         rocblas_int       lda,
+                                         const void*       b,
+                                         rocblas_datatype  b_type,
+                                         rocblas_int       ldb,
+                                         const void*       beta,
+                                         const void*       c,
+                                         rocblas_datatype  c_type,
+                                         rocblas_int       ldc,
+                                         void*             d,
+                                         rocblas_datatype  d_type,
+                                         rocblas_int       ldd,
+                                         rocblas_int       batch_count,
+                                         rocblas_datatype  compute_type,
+                                         rocblas_gemm_algo algo,
+                                         int32_t           solution_index,
+                                         uint32_t          flags)
+{
+    // rocBLAS multiplies 8-bit floats through its ex3 API, which takes a compute type of its own
+    // and has no solutions to tune
+    if(hipblasIs8BitFloat(a_type) || hipblasIs8BitFloat(b_type))
+    {
+        float alpha_scaled;
+        if(!hipblasScaleGemmAlpha(handle, alpha, alpha_scaled))
+            return rocblas_status_not_implemented;
+
+        return rocblas_gemm_batched_ex3(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        a,
+                                        a_type,
+                                        lda,
+                                        b,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        c,
+                                        c_type,
+                                        ldc,
+                                        d,
+                                        d_type,
+                                        ldd,
+                                        batch_count,
+                                        rocblas_compute_type_f32,
+                                        algo,
+                                        solution_index,
+                                        flags);
+    }
+
+    int device;
+    if(hipblasGemmTuningActive() && algo == rocblas_gemm_algo_standard && solution_index == 0
+       && m > 0 && n > 0 && batch_count > 0 && ldd >= m && hipGetDevice(&device) == hipSuccess)
+    {
+        hipblasGemmTuneKey key{device,
+                               hipblas_tune_gemm_batched_ex,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               a_type,
+                               lda,
+                               b_type,
+                               ldb,
+                               c_type,
+                               ldc,
+                               d_type,
+                               ldd,
+                               compute_type,
+                               flags,
+                               batch_count,
+                               0,
+                               hipblasGemmTuneMathMode(handle)};
+
+        auto get_solutions = [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_batched_ex_get_solutions(handle,
+                                                         transA,
+                                                         transB,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         a,
+                                                         a_type,
+                                                         lda,
+                                                         b,
+                                                         b_type,
+                                                         ldb,
+                                                         beta,
+                                                         c,
+                                                         c_type,
+                                                         ldc,
+                                                         d,
+                                                         d_type,
+                                                         ldd,
+                                                         batch_count,
+                                                         compute_type,
+                                                         rocblas_gemm_algo_solution_index,
+                                                         flags,
+                                                         list,
+                                                         size);
+        };
+        auto run = [&](rocblas_int solution, void* d_run) {
+            return rocblas_gemm_batched_ex(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           a,
+                                           a_type,
+                                           lda,
+                                           b,
+                                           b_type,
+                                           ldb,
+                                           beta,
+                                           c,
+                                           c_type,
+                                           ldc,
+                                           d_run,
+                                           d_type,
+                                           ldd,
+                                           batch_count,
+                                           compute_type,
+                                           rocblas_gemm_algo_solution_index,
+                                           solution,
+                                           flags);
+        };
+
+        // The scratch array of batch_count pointers comes first, followed by the matrices
+        // it points to
+        size_t matrix_bytes = size_t(ldd) * n * hipblasDatatypeSize(d_type);
+        size_t array_bytes  = sizeof(void*) * batch_count;
+        auto   prepare      = [&](void* scratch) {
+            std::vector<char*> d_array(batch_count);
+            for(rocblas_int i = 0; i < batch_count; i++)
+                d_array[i] = static_cast<char*>(scratch) + array_bytes + matrix_bytes * i;
+            return hipMemcpy(scratch, d_array.data(), array_bytes, hipMemcpyHostToDevice)
+                   == hipSuccess;
+        };
+
+        size_t  scratch_bytes = matrix_bytes ? array_bytes + matrix_bytes * batch_count : 0;
+        int32_t solution
+            = hipblasGemmSolution(handle, key, scratch_bytes, get_solutions, prepare, run);
+        if(solution >= 0)
+            return run(solution, d);
+    }
+
+    return rocblas_gemm_batched_ex(handle,
+                                   transA,
+                                   transB,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   a,
+                                   a_type,
+                                   lda,
+                                   b,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   c,
+                                   c_type,
+                                   ldc,
+                                   d,
+                                   d_type,
+                                   ldd,
+                                   batch_count,
+                                   compute_type,
+                                   algo,
+                                   solution_index,
+                                   flags);
+}
+
+rocblas_status hipblasTunedGemmStridedBatchedEx(rocblas_handle    handle,
+                                                rocblas_operation transA,
+                                                rocblas_operation transB,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const void*       alpha,
+                                                const void*       a,
+                                                rocblas_datatype  a_type,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_a,
+                                                const void*       b,
+                                                rocblas_datatype  b_type,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_b,
+                                                const void*       beta,
+                                                const void*       c,
+                                                rocblas_datatype  c_type,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_c,
+                                                void*             d,
+                                                rocblas_datatype  d_type,
+                                                rocblas_int       ldd,
+                                                rocblas_stride    stride_d,
+                                                rocblas_int       batch_count,
+                                                rocblas_datatype  compute_type,
+                                                rocblas_gemm_algo algo,
+                                                int32_t           solution_index,
+                                                uint32_t          flags)
+{
+    // rocBLAS multiplies 8-bit floats through its ex3 API, which takes a compute type of its own
+    // and has no solutions to tune
+    if(hipblasIs8BitFloat(a_type) || hipblasIs8BitFloat(b_type))
+    {
+        float alpha_scaled;
+        if(!hipblasScaleGemmAlpha(handle, alpha, alpha_scaled))
+            return rocblas_status_not_implemented;
+
+        return rocblas_gemm_strided_batched_ex3(handle,
+                                                transA,
+                                                transB,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                a_type,
+                                                lda,
+                                                stride_a,
+                                                b,
+                                                b_type,
+                                                ldb,
+                                                stride_b,
+                                                beta,
+                                                c,
+                                                c_type,
+                                                ldc,
+                                                stride_c,
+                                                d,
+                                                d_type,
+                                                ldd,
+                                                stride_d,
+                                                batch_count,
+                                                rocblas_compute_type_f32,
+                                                algo,
+                                                solution_index,
+                                                flags);
+    }
+
+    int device;
+    if(hipblasGemmTuningActive() && algo == rocblas_gemm_algo_standard && solution_index == 0
+       && m > 0 && n > 0 && batch_count > 0 && ldd >= m && hipGetDevice(&device) == hipSuccess)
+    {
+        // A zero stride broadcasts one operand to every batch, which suits different
+        // solutions than distinct operands do
+        hipblasGemmTuneKey key{device,
+                               hipblas_tune_gemm_strided_batched_ex,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               a_type,
+                               lda,
+                               b_type,
+                               ldb,
+                               c_type,
+                               ldc,
+                               d_type,
+                               ldd,
+                               compute_type,
+                               flags,
+                               batch_count,
+                               (stride_a == 0) | (stride_b == 0) << 1 | (stride_c == 0) << 2,
+                               hipblasGemmTuneMathMode(handle)};
+
+        // The scratch D is packed, independently of stride_d
+        rocblas_stride scratch_stride = rocblas_stride(ldd) * n;
+
+        auto get_solutions = [&](rocblas_int* list, rocblas_int* size) {
+            return rocblas_gemm_strided_batched_ex_get_solutions(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 a,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 b,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 c,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 d,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 rocblas_gemm_algo_solution_index,
+                                                                 flags,
+                                                                 list,
+                                                                 size);
+        };
+        auto run = [&](rocblas_int solution, void* d_run, rocblas_stride stride_d_run) {
+            return rocblas_gemm_strided_batched_ex(handle,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   a,
+                                                   a_type,
+                                                   lda,
+                                                   stride_a,
+                                                   b,
+                                                   b_type,
+                                                   ldb,
+                                                   stride_b,
+                                                   beta,
+                                                   c,
+                                                   c_type,
+                                                   ldc,
+                                                   stride_c,
+                                                   d_run,
+                                                   d_type,
+                                                   ldd,
+                                                   stride_d_run,
+                                                   batch_count,
+                                                   compute_type,
+                                                   rocblas_gemm_algo_solution_index,
+                                                   solution,
+                                                   flags);
+        };
+
+        size_t  d_bytes  = size_t(scratch_stride) * batch_count * hipblasDatatypeSize(d_type);
+        int32_t solution = hipblasGemmSolution(
+            handle,
+            key,
+            d_bytes,
+            get_solutions,
+            [](void*) { return true; },
+            [&](rocblas_int s, void* scratch) { return run(s, scratch, scratch_stride); });
+        if(solution >= 0)
+            return run(solution, d, stride_d);
+    }
+
+    return rocblas_gemm_strided_batched_ex(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           a,
+                                           a_type,
+                                           lda,
+                                           stride_a,
+                                           b,
+                                           b_type,
+                                           ldb,
+                                           stride_b,
+                                           beta,
+                                           c,
+                                           c_type,
+                                           ldc,
+                                           stride_c,
+                                           d,
+                                           d_type,
+                                           ldd,
+                                           stride_d,
+                                           batch_count,
+                                           compute_type,
+                                           algo,
+                                           solution_index,
+                                           flags);
+}
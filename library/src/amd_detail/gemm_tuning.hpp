@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas/rocblas.h"
+#include <cstdint>
+
+/*! \brief Read the tuning database named by HIPBLAS_GEMM_TUNING_DB, once per process.
+ *
+ *  GEMMs left to the default rocBLAS solution then run with the solution the database holds
+ *  for their problem on the architecture of the current device. With HIPBLAS_GEMM_TUNING set
+ *  to a non-zero value, or after hipblasSetGemmTuning(1), the problems the database does not
+ *  cover are tuned the first time they are seen on a device by timing every solution rocBLAS
+ *  offers for them, and the choice is kept for the rest of the process.
+ */
+void hipblasLoadGemmTuningDatabase();
+
+/*! \brief Drop-in replacements for rocblas_gemm_ex, rocblas_gemm_batched_ex and
+ *         rocblas_gemm_strided_batched_ex. When tuning is active, a call asking for
+ *         rocblas_gemm_algo_standard and solution 0 runs with the tuned solution; any other
+ *         call is passed through unchanged. Calls with 8-bit float inputs run through the
+ *         rocBLAS ex3 API instead, with the scale factors set by hipblasSetGemmExScales.
+ */
+rocblas_status hipblasTunedGemmEx(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  const void*       alpha,
+                                  const void*       a,
+                                  rocblas_datatype  a_type,
+                                  rocblas_int       lda,
+                                  const void*       b,
+                                  rocblas_datatype  b_type,
+                                  rocblas_int       ldb,
+                                  const void*       beta,
+                                  const void*       c,
+                                  rocblas_datatype  c_type,
+                                  rocblas_int       ldc,
+                                  void*             d,
+                                  rocblas_datatype  d_type,
+                                  rocblas_int       ldd,
+                                  rocblas_datatype  compute_type,
+                                  rocblas_gemm_algo algo,
+                                  int32_t           solution_index,
+                                  uint32_t          flags);
+
+rocblas_status hipblasTunedGemmBatchedEx(rocblas_handle    handle,
+                                         rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const void*       alpha,
+                                         const void*       a,
+                                         rocblas_datatype  a_type,
+                                         rocblas_int       lda,
+                                         const void*       b,
+                                         rocblas_datatype  b_type,
+                                         rocblas_int       ldb,
+                                         const void*       beta,
+                                         const void*       c,
+                                         rocblas_datatype  c_type,
+                                         rocblas_int       ldc,
+                                         void*             d,
+                                         rocblas_datatype  d_type,
+                                         rocblas_int       ldd,
+                                         rocblas_int       batch_count,
+                                         rocblas_datatype  compute_type,
+                                         rocblas_gemm_algo algo,
+                                         int32_t           solution_index,
+                                         uint32_t          flags);
+
+rocblas_status hipblasTunedGemmStridedBatchedEx(rocblas_handle    handle,
+                                                rocblas_operation transA,
+                                                rocblas_operation transB,
+                                                rocblas_int       m,
+                                                rocblas_int       n,
+                                                rocblas_int       k,
+                                                const void*       alpha,
+                                                const void*       a,
+                                                rocblas_datatype  a_type,
+                                                rocblas_int       lda,
+                                                rocblas_stride    stride_a,
+                                                const void*       b,
+                                                rocblas_datatype  b_type,
+                                                rocblas_int       ldb,
+                                                rocblas_stride    stride_b,
+                                                const void*       beta,
+                                                const void*       c,
+                                                rocblas_datatype  c_type,
+                                                rocblas_int       ldc,
+                                                rocblas_stride    stride_c,
+                                                void*             d,
+                                                rocblas_datatype  d_type,
+                                                rocblas_int       ldd,
+                                                rocblas_stride    stride_d,
+                                                rocblas_int       batch_count,
+                                                rocblas_datatype  compute_type,
+                                                rocblas_gemm_algo algo,
+                                                int32_t           solution_index,
+                                                uint32_t          flags);
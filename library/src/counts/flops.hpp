@@ -25,6 +25,7 @@
 #define _HIPBLAS_FLOPS_H_
 
 #include "hipblas.h"
+#include <algorithm>
 
 /*!\file
  * \brief provides Floating point counts of Basic Linear Algebra Subprograms (BLAS) of Level 1, 2,
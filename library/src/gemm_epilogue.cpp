@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Device code of the rocBLAS and cuBLAS backends; built as its own object library, with
+// hip::device or as CUDA, so the wrappers in hipblas.cpp stay host-only
+
+#include "gemm_epilogue.hpp"
+#include <algorithm>
+#include <hip/hip_bf16.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+namespace
+{
+    constexpr int requantize_dim_x = 64;
+    constexpr int requantize_dim_y = 4;
+
+    constexpr int epilogue_dim_x = 64;
+    constexpr int epilogue_dim_y = 4;
+
+    constexpr int pointer_array_dim = 256;
+
+    template <typename T>
+    __device__ T hipblas_requantize_convert(float value, int32_t zero_point);
+
+    // The sum is clamped in float, so a product far out of range cannot overflow the conversion
+    template <>
+    __device__ int8_t hipblas_requantize_convert<int8_t>(float value, int32_t zero_point)
+    {
+        float q = rintf(value) + float(zero_point);
+        return int8_t(fminf(fmaxf(q, -128.0f), 127.0f));
+    }
+
+    template <>
+    __device__ __half hipblas_requantize_convert<__half>(float value, int32_t)
+    {
+        return __float2half(value);
+    }
+
+    // Threads of a block run down a column, so acc and c are both read and written coalesced
+    template <typename T>
+    __global__ void __launch_bounds__(requantize_dim_x * requantize_dim_y)
+        hipblas_requantize_kernel(int64_t m,
+                                  int64_t n,
+                                  const int32_t* __restrict__ acc,
+                                  int64_t ld_acc,
+                                  const float* __restrict__ row_scale,
+                                  const float* __restrict__ col_scale,
+                                  int32_t zero_point,
+                                  T* __restrict__ c,
+                                  int64_t ldc)
+    {
+        int64_t i = int64_t(blockIdx.x) * requantize_dim_x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        float row = row_scale ? row_scale[i] : 1.0f;
+        for(int64_t j = int64_t(blockIdx.y) * requantize_dim_y + threadIdx.y; j < n;
+            j += int64_t(gridDim.y) * requantize_dim_y)
+        {
+            float scale    = col_scale ? row * col_scale[j] : row;
+            c[i + j * ldc] = hipblas_requantize_convert<T>(scale * float(acc[i + j * ld_acc]),
+                                                            zero_point);
+        }
+    }
+
+    // Precision the epilogue is evaluated in, and conversions to and from it
+    template <typename T>
+    using hipblas_epilogue_compute_t = std::conditional_t<std::is_same<T, double>{}, double, float>;
+
+    __device__ float hipblas_epilogue_load(__half x)
+    {
+        return __half2float(x);
+    }
+
+    __device__ float hipblas_epilogue_load(__hip_bfloat16 x)
+    {
+        return __bfloat162float(x);
+    }
+
+    __device__ float hipblas_epilogue_load(float x)
+    {
+        return x;
+    }
+
+    __device__ double hipblas_epilogue_load(double x)
+    {
+        return x;
+    }
+
+    template <typename T>
+    __device__ T hipblas_epilogue_store(hipblas_epilogue_compute_t<T> x)
+    {
+        if constexpr(std::is_same<T, __half>{})
+            return __float2half(x);
+        else if constexpr(std::is_same<T, __hip_bfloat16>{})
+            return __float2bfloat16(x);
+        else
+            return x;
+    }
+
+    template <typename Tc>
+    __device__ Tc hipblas_epilogue_activate(hipblasEpilogueActivation activation, Tc x)
+    {
+        if(activation == hipblas_epilogue_activation_relu)
+            return x > Tc(0) ? x : Tc(0);
+        if(activation == hipblas_epilogue_activation_gelu)
+        {
+            const Tc sqrt_2_over_pi = Tc(0.7978845608028654);
+            return Tc(0.5) * x * (Tc(1) + tanh(sqrt_2_over_pi * (x + Tc(0.044715) * x * x * x)));
+        }
+        return x;
+    }
+
+    // Same layout as the requantize kernel, with one batch instance per grid z index. aux may
+    // alias d, so neither is restrict.
+    template <typename T>
+    __global__ void __launch_bounds__(epilogue_dim_x * epilogue_dim_y)
+        hipblas_gemm_epilogue_kernel(int64_t                   m,
+                                     int64_t                   n,
+                                     int64_t                   batch_count,
+                                     hipblasEpilogueActivation activation,
+                                     const T* __restrict__ bias,
+                                     int64_t  stride_bias,
+                                     const T* aux,
+                                     int64_t  ld_aux,
+                                     int64_t  stride_aux,
+                                     T*       d,
+                                     int64_t  ldd,
+                                     int64_t  stride_d)
+    {
+        using Tc  = hipblas_epilogue_compute_t<T>;
+        int64_t i = int64_t(blockIdx.x) * epilogue_dim_x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            Tc       row   = bias ? hipblas_epilogue_load(bias[i + b * stride_bias]) : Tc(0);
+            T*       d_b   = d + b * stride_d;
+            const T* aux_b = aux ? aux + b * stride_aux : nullptr;
+            for(int64_t j = int64_t(blockIdx.y) * epilogue_dim_y + threadIdx.y; j < n;
+                j += int64_t(gridDim.y) * epilogue_dim_y)
+            {
+                Tc value = hipblas_epilogue_activate(
+                    activation, hipblas_epilogue_load(d_b[i + j * ldd]) + row);
+                if(aux_b)
+                    value += hipblas_epilogue_load(aux_b[i + j * ld_aux]);
+                d_b[i + j * ldd] = hipblas_epilogue_store<T>(value);
+            }
+        }
+    }
+
+    __global__ void __launch_bounds__(pointer_array_dim)
+        hipblas_pointer_array_kernel(char* base, size_t stride, int64_t count, void** array)
+    {
+        int64_t b = int64_t(blockIdx.x) * pointer_array_dim + threadIdx.x;
+        if(b < count)
+            array[b] = base + b * stride;
+    }
+
+    // Same layout as the epilogue kernel. The products are packed, with leading dimension m, in
+    // the precision of the scalars.
+    template <typename T, typename Ts>
+    __global__ void __launch_bounds__(epilogue_dim_x * epilogue_dim_y)
+        hipblas_scalar_stride_kernel(int64_t m,
+                                     int64_t n,
+                                     int64_t batch_count,
+                                     const Ts* __restrict__ alpha,
+                                     int64_t stride_alpha,
+                                     const Ts* __restrict__ beta,
+                                     int64_t stride_beta,
+                                     const Ts* __restrict__ product,
+                                     T* c,
+                                     T* const* __restrict__ c_array,
+                                     int64_t ldc,
+                                     int64_t stride_c)
+    {
+        using Tc  = hipblas_epilogue_compute_t<T>;
+        int64_t i = int64_t(blockIdx.x) * epilogue_dim_x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int64_t b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            Tc        alpha_b   = hipblas_epilogue_load(alpha[b * stride_alpha]);
+            Tc        beta_b    = hipblas_epilogue_load(beta[b * stride_beta]);
+            const Ts* product_b = product + b * m * n;
+            T*        c_b       = c_array ? c_array[b] : c + b * stride_c;
+            for(int64_t j = int64_t(blockIdx.y) * epilogue_dim_y + threadIdx.y; j < n;
+                j += int64_t(gridDim.y) * epilogue_dim_y)
+            {
+                Tc value = alpha_b * hipblas_epilogue_load(product_b[i + j * m]);
+                if(beta_b != Tc(0))
+                    value += beta_b * hipblas_epilogue_load(c_b[i + j * ldc]);
+                c_b[i + j * ldc] = hipblas_epilogue_store<T>(value);
+            }
+        }
+    }
+
+    template <typename T, typename Ts>
+    void hipblas_launch_scalar_stride(hipStream_t  stream,
+                                      int64_t      m,
+                                      int64_t      n,
+                                      int64_t      batch_count,
+                                      const void*  alpha,
+                                      int64_t      stride_alpha,
+                                      const void*  beta,
+                                      int64_t      stride_beta,
+                                      const void*  product,
+                                      void*        c,
+                                      void* const* c_array,
+                                      int64_t      ldc,
+                                      int64_t      stride_c)
+    {
+        dim3 block(epilogue_dim_x, epilogue_dim_y);
+        dim3 grid((m - 1) / epilogue_dim_x + 1,
+                  std::min<int64_t>((n - 1) / epilogue_dim_y + 1, 65535),
+                  std::min<int64_t>(batch_count, 65535));
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(hipblas_scalar_stride_kernel<T, Ts>),
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           batch_count,
+                           static_cast<const Ts*>(alpha),
+                           stride_alpha,
+                           static_cast<const Ts*>(beta),
+                           stride_beta,
+                           static_cast<const Ts*>(product),
+                           static_cast<T*>(c),
+                           reinterpret_cast<T* const*>(c_array),
+                           ldc,
+                           stride_c);
+    }
+
+    template <typename T>
+    void hipblas_launch_gemm_epilogue(hipStream_t               stream,
+                                      int64_t                   m,
+                                      int64_t                   n,
+                                      int64_t                   batch_count,
+                                      hipblasEpilogueActivation activation,
+                                      const void*               bias,
+                                      int64_t                   stride_bias,
+                                      const void*               aux,
+                                      int64_t                   ld_aux,
+                                      int64_t                   stride_aux,
+                                      void*                     d,
+                                      int64_t                   ldd,
+                                      int64_t                   stride_d)
+    {
+        // Columns and instances beyond the grid limits are covered by the loops in the kernel
+        dim3 block(epilogue_dim_x, epilogue_dim_y);
+        dim3 grid((m - 1) / epilogue_dim_x + 1,
+                  std::min<int64_t>((n - 1) / epilogue_dim_y + 1, 65535),
+                  std::min<int64_t>(batch_count, 65535));
+
+        hipLaunchKernelGGL(hipblas_gemm_epilogue_kernel<T>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           batch_count,
+                           activation,
+                           static_cast<const T*>(bias),
+                           stride_bias,
+                           static_cast<const T*>(aux),
+                           ld_aux,
+                           stride_aux,
+                           static_cast<T*>(d),
+                           ldd,
+                           stride_d);
+    }
+}
+
+// The half constants are stored as their bits, 0x3c00 being 1
+__constant__ uint16_t hipblas_device_half_one_zero[2]   = {0x3c00, 0};
+__constant__ float    hipblas_device_float_one_zero[2]  = {1, 0};
+__constant__ double   hipblas_device_double_one_zero[2] = {1, 0};
+__constant__ int32_t  hipblas_device_int32_one_zero[2]  = {1, 0};
+
+const void* hipblasDeviceOneZero(hipDataType type)
+{
+    void*      address = nullptr;
+    hipError_t status  = hipErrorInvalidValue;
+    switch(type)
+    {
+    case HIP_R_16F:
+        status = hipGetSymbolAddress(&address, HIP_SYMBOL(hipblas_device_half_one_zero));
+        break;
+    case HIP_R_32F:
+        status = hipGetSymbolAddress(&address, HIP_SYMBOL(hipblas_device_float_one_zero));
+        break;
+    case HIP_R_64F:
+        status = hipGetSymbolAddress(&address, HIP_SYMBOL(hipblas_device_double_one_zero));
+        break;
+    case HIP_R_32I:
+        status = hipGetSymbolAddress(&address, HIP_SYMBOL(hipblas_device_int32_one_zero));
+        break;
+    default:
+        break;
+    }
+    return status == hipSuccess ? address : nullptr;
+}
+
+hipError_t hipblasLaunchRequantize(hipStream_t    stream,
+                                   int64_t        m,
+                                   int64_t        n,
+                                   const int32_t* acc,
+                                   int64_t        ld_acc,
+                                   const float*   row_scale,
+                                   const float*   col_scale,
+                                   int32_t        zero_point,
+                                   void*          c,
+                                   hipDataType    c_type,
+                                   int64_t        ldc)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    // Columns beyond the grid limit are covered by the loop in the kernel
+    dim3 block(requantize_dim_x, requantize_dim_y);
+    dim3 grid((m - 1) / requantize_dim_x + 1,
+              std::min<int64_t>((n - 1) / requantize_dim_y + 1, 65535));
+
+    if(c_type == HIP_R_8I)
+        hipLaunchKernelGGL(hipblas_requantize_kernel<int8_t>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           acc,
+                           ld_acc,
+                           row_scale,
+                           col_scale,
+                           zero_point,
+                           static_cast<int8_t*>(c),
+                           ldc);
+    else if(c_type == HIP_R_16F)
+        hipLaunchKernelGGL(hipblas_requantize_kernel<__half>,
+                           grid,
+                           block,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           acc,
+                           ld_acc,
+                           row_scale,
+                           col_scale,
+                           zero_point,
+                           static_cast<__half*>(c),
+                           ldc);
+    else
+        return hipErrorInvalidValue;
+
+    return hipGetLastError();
+}
+
+hipError_t hipblasLaunchGemmEpilogue(hipStream_t               stream,
+                                     int64_t                   m,
+                                     int64_t                   n,
+                                     int64_t                   batch_count,
+                                     hipblasEpilogueActivation activation,
+                                     const void*               bias,
+                                     int64_t                   stride_bias,
+                                     const void*               aux,
+                                     int64_t                   ld_aux,
+                                     int64_t                   stride_aux,
+                                     void*                     d,
+                                     hipDataType               d_type,
+                                     int64_t                   ldd,
+                                     int64_t                   stride_d)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    auto launch = [&](auto type_tag) {
+        hipblas_launch_gemm_epilogue<decltype(type_tag)>(stream,
+                                                         m,
+                                                         n,
+                                                         batch_count,
+                                                         activation,
+                                                         bias,
+                                                         stride_bias,
+                                                         aux,
+                                                         ld_aux,
+                                                         stride_aux,
+                                                         d,
+                                                         ldd,
+                                                         stride_d);
+    };
+
+    switch(d_type)
+    {
+    case HIP_R_16F:
+        launch(__half());
+        break;
+    case HIP_R_16BF:
+        launch(__hip_bfloat16());
+        break;
+    case HIP_R_32F:
+        launch(float());
+        break;
+    case HIP_R_64F:
+        launch(double());
+        break;
+    default:
+        return hipErrorInvalidValue;
+    }
+    return hipGetLastError();
+}
+
+hipError_t hipblasLaunchPointerArray(
+    hipStream_t stream, void* base, size_t stride, int64_t count, void** array)
+{
+    if(count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(hipblas_pointer_array_kernel,
+                       dim3((count - 1) / pointer_array_dim + 1),
+                       dim3(pointer_array_dim),
+                       0,
+                       stream,
+                       static_cast<char*>(base),
+                       stride,
+                       count,
+                       array);
+    return hipGetLastError();
+}
+
+hipError_t hipblasLaunchScalarStride(hipStream_t  stream,
+                                     int64_t      m,
+                                     int64_t      n,
+                                     int64_t      batch_count,
+                                     const void*  alpha,
+                                     int64_t      stride_alpha,
+                                     const void*  beta,
+                                     int64_t      stride_beta,
+                                     hipDataType  scalar_type,
+                                     const void*  product,
+                                     void*        c,
+                                     void* const* c_array,
+                                     hipDataType  c_type,
+                                     int64_t      ldc,
+                                     int64_t      stride_c)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    auto launch = [&](auto type_tag, auto scalar_tag) {
+        hipblas_launch_scalar_stride<decltype(type_tag), decltype(scalar_tag)>(stream,
+                                                                               m,
+                                                                               n,
+                                                                               batch_count,
+                                                                               alpha,
+                                                                               stride_alpha,
+                                                                               beta,
+                                                                               stride_beta,
+                                                                               product,
+                                                                               c,
+                                                                               c_array,
+                                                                               ldc,
+                                                                               stride_c);
+    };
+
+    if(c_type == HIP_R_16F && scalar_type == HIP_R_16F)
+        launch(__half(), __half());
+    else if(c_type == HIP_R_16F && scalar_type == HIP_R_32F)
+        launch(__half(), float());
+    else if(c_type == HIP_R_16BF && scalar_type == HIP_R_32F)
+        launch(__hip_bfloat16(), float());
+    else if(c_type == HIP_R_32F && scalar_type == HIP_R_32F)
+        launch(float(), float());
+    else if(c_type == HIP_R_64F && scalar_type == HIP_R_64F)
+        launch(double(), double());
+    else
+        return hipErrorInvalidValue;
+    return hipGetLastError();
+}
@@ -0,0 +1,1055 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Batched GEMM Ex with one alpha and beta per instance, built on the batched and strided
+// batched GEMM Ex of the backend so that every backend gets the same splitting. Each run is
+// issued, and logged, as the batched GEMM it becomes.
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "gemm_grouped.hpp"
+#include "handle_state.hpp"
+#include <cstring>
+
+namespace
+{
+    // Size of one element of a GEMM Ex matrix, so that strided-batched pointers can be advanced
+    // by whole instances; 0 for a type no GEMM takes, which the GEMM itself then rejects
+    size_t hipblas_gemm_ex_element_size(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+        case HIP_R_8F_E4M3_FNUZ:
+        case HIP_R_8F_E5M2_FNUZ:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+        case HIP_C_8U:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+        case HIP_R_32U:
+        case HIP_C_16F:
+        case HIP_C_16BF:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+        case HIP_C_32I:
+        case HIP_C_32U:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    size_t hipblas_gemm_ex_element_size(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_8I:
+        case HIPBLAS_R_8U:
+            return 1;
+        case HIPBLAS_R_16F:
+        case HIPBLAS_R_16B:
+        case HIPBLAS_C_8I:
+        case HIPBLAS_C_8U:
+            return 2;
+        case HIPBLAS_R_32F:
+        case HIPBLAS_R_32I:
+        case HIPBLAS_R_32U:
+        case HIPBLAS_C_16F:
+        case HIPBLAS_C_16B:
+            return 4;
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_32F:
+        case HIPBLAS_C_32I:
+        case HIPBLAS_C_32U:
+            return 8;
+        case HIPBLAS_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Type of a GEMM Ex C for hipblasGemmScalarStrideDevice; HIP_R_8I, which no backend scales,
+    // for the types it does not take
+    hipDataType hipblas_gemm_ex_c_type(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return HIP_R_16F;
+        case HIPBLAS_R_16B:
+            return HIP_R_16BF;
+        case HIPBLAS_R_32F:
+            return HIP_R_32F;
+        case HIPBLAS_R_64F:
+            return HIP_R_64F;
+        default:
+            return HIP_R_8I;
+        }
+    }
+
+    // Calls the GEMM lambda of type P that product_context points to
+    template <typename P>
+    hipblasStatus_t hipblas_scalar_stride_product(void*       product_context,
+                                                  void*       d,
+                                                  hipDataType d_type,
+                                                  int64_t     ldd,
+                                                  const void* one,
+                                                  const void* zero)
+    {
+        return (*static_cast<P*>(product_context))(d, d_type, ldd, one, zero);
+    }
+
+    // The hipblasDatatype_t of a type hipblasGemmScalarStrideDevice hands to a product
+    hipblasDatatype_t hipblas_gemm_ex_datatype(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_16F:
+            return HIPBLAS_R_16F;
+        case HIP_R_16BF:
+            return HIPBLAS_R_16B;
+        case HIP_R_32F:
+            return HIPBLAS_R_32F;
+        default:
+            return HIPBLAS_R_64F;
+        }
+    }
+
+    /*! \brief Issue a batched GEMM whose alpha and beta advance by stride_alpha and stride_beta
+     *  scalars per instance as batched GEMMs with one alpha and beta each.
+     *
+     *  run(first, count, alpha, beta) runs the count instances that start at instance first. Host
+     *  scalars are compared, and consecutive instances with the same alpha and beta share a run.
+     *  Device scalars cannot be read without a synchronization, so the whole batch is handed to
+     *  hipblasGemmScalarStrideDevice with product, the GEMM into its scratch memory; where the
+     *  backend does not take it, each instance is its own run. c, c_batched, ldc and stride_c
+     *  describe the m by n matrices C of type c_type. With both strides 0, or null scalars, or no
+     *  instance, there is a single run for the whole batch, which reports any invalid argument
+     *  itself. Stops at, and returns, the first error.
+     */
+    template <typename F, typename P>
+    hipblasStatus_t hipblas_gemm_scalar_stride_execute(hipblasHandle_t handle,
+                                                       int64_t         m,
+                                                       int64_t         n,
+                                                       int64_t         batch_count,
+                                                       const void*     alpha,
+                                                       hipblasStride   stride_alpha,
+                                                       const void*     beta,
+                                                       hipblasStride   stride_beta,
+                                                       size_t          scalar_size,
+                                                       hipDataType     c_type,
+                                                       void*           c,
+                                                       bool            c_batched,
+                                                       int64_t         ldc,
+                                                       hipblasStride   stride_c,
+                                                       F&&             run,
+                                                       P&              product)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(stride_alpha < 0 || stride_beta < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if((!stride_alpha && !stride_beta) || !alpha || !beta || batch_count <= 0)
+            return run(0, batch_count, alpha, beta);
+
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE && batch_count > 1)
+        {
+            // A row-major C is stored as its transpose
+            bool row_major = hipblasGetHandleState(handle)->order == HIPBLAS_ORDER_ROW_MAJOR;
+            status         = hipblasGemmScalarStrideDevice(handle,
+                                                           row_major ? n : m,
+                                                           row_major ? m : n,
+                                                           batch_count,
+                                                           alpha,
+                                                           stride_alpha,
+                                                           beta,
+                                                           stride_beta,
+                                                           scalar_size,
+                                                           c_type,
+                                                           c,
+                                                           c_batched,
+                                                           ldc,
+                                                           stride_c,
+                                                           hipblas_scalar_stride_product<P>,
+                                                           &product);
+            if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+                return status;
+        }
+
+        auto alpha_i = [&](int64_t i) {
+            return hipblas_grouped_offset(alpha, i * stride_alpha, scalar_size);
+        };
+        auto beta_i = [&](int64_t i) {
+            return hipblas_grouped_offset(beta, i * stride_beta, scalar_size);
+        };
+
+        int64_t first = 0;
+        for(int64_t i = 1; i <= batch_count; i++)
+        {
+            if(i < batch_count && mode == HIPBLAS_POINTER_MODE_HOST
+               && !memcmp(alpha_i(i), alpha_i(first), scalar_size)
+               && !memcmp(beta_i(i), beta_i(first), scalar_size))
+                continue;
+
+            status = run(first, i - first, alpha_i(first), beta_i(first));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            first = i;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithScalarStride(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const void*        alpha,
+                                                     hipblasStride      strideAlpha,
+                                                     const void*        A[],
+                                                     hipblasDatatype_t  aType,
+                                                     int                lda,
+                                                     const void*        B[],
+                                                     hipblasDatatype_t  bType,
+                                                     int                ldb,
+                                                     const void*        beta,
+                                                     hipblasStride      strideBeta,
+                                                     void*              C[],
+                                                     hipblasDatatype_t  cType,
+                                                     int                ldc,
+                                                     int                batchCount,
+                                                     hipblasDatatype_t  computeType,
+                                                     hipblasGemmAlgo_t  algo)
+try
+{
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        return hipblasGemmBatchedEx(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha_i,
+                                    hipblas_grouped_offset(A, first),
+                                    aType,
+                                    lda,
+                                    hipblas_grouped_offset(B, first),
+                                    bType,
+                                    ldb,
+                                    beta_i,
+                                    hipblas_grouped_offset(C, first),
+                                    cType,
+                                    ldc,
+                                    int(count),
+                                    computeType,
+                                    algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmBatchedEx(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    one,
+                                    A,
+                                    aType,
+                                    lda,
+                                    B,
+                                    bType,
+                                    ldb,
+                                    zero,
+                                    static_cast<void**>(d),
+                                    hipblas_gemm_ex_datatype(d_type),
+                                    int(ldd),
+                                    batchCount,
+                                    computeType,
+                                    algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType),
+                                              hipblas_gemm_ex_c_type(cType),
+                                              (void*)C,
+                                              true,
+                                              ldc,
+                                              0,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithScalarStride_v2(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transA,
+                                                        hipblasOperation_t   transB,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        hipblasStride        strideAlpha,
+                                                        const void*          A[],
+                                                        hipDataType          aType,
+                                                        int                  lda,
+                                                        const void*          B[],
+                                                        hipDataType          bType,
+                                                        int                  ldb,
+                                                        const void*          beta,
+                                                        hipblasStride        strideBeta,
+                                                        void*                C[],
+                                                        hipDataType          cType,
+                                                        int                  ldc,
+                                                        int                  batchCount,
+                                                        hipblasComputeType_t computeType,
+                                                        hipblasGemmAlgo_t    algo)
+try
+{
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        return hipblasGemmBatchedEx_v2(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha_i,
+                                       hipblas_grouped_offset(A, first),
+                                       aType,
+                                       lda,
+                                       hipblas_grouped_offset(B, first),
+                                       bType,
+                                       ldb,
+                                       beta_i,
+                                       hipblas_grouped_offset(C, first),
+                                       cType,
+                                       ldc,
+                                       int(count),
+                                       computeType,
+                                       algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmBatchedEx_v2(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       one,
+                                       A,
+                                       aType,
+                                       lda,
+                                       B,
+                                       bType,
+                                       ldb,
+                                       zero,
+                                       static_cast<void**>(d),
+                                       d_type,
+                                       int(ldd),
+                                       batchCount,
+                                       computeType,
+                                       algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType, cType),
+                                              cType,
+                                              (void*)C,
+                                              true,
+                                              ldc,
+                                              0,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithScalarStride_64(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transA,
+                                                        hipblasOperation_t transB,
+                                                        int64_t            m,
+                                                        int64_t            n,
+                                                        int64_t            k,
+                                                        const void*        alpha,
+                                                        hipblasStride      strideAlpha,
+                                                        const void*        A[],
+                                                        hipblasDatatype_t  aType,
+                                                        int64_t            lda,
+                                                        const void*        B[],
+                                                        hipblasDatatype_t  bType,
+                                                        int64_t            ldb,
+                                                        const void*        beta,
+                                                        hipblasStride      strideBeta,
+                                                        void*              C[],
+                                                        hipblasDatatype_t  cType,
+                                                        int64_t            ldc,
+                                                        int64_t            batchCount,
+                                                        hipblasDatatype_t  computeType,
+                                                        hipblasGemmAlgo_t  algo)
+try
+{
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        return hipblasGemmBatchedEx_64(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha_i,
+                                       hipblas_grouped_offset(A, first),
+                                       aType,
+                                       lda,
+                                       hipblas_grouped_offset(B, first),
+                                       bType,
+                                       ldb,
+                                       beta_i,
+                                       hipblas_grouped_offset(C, first),
+                                       cType,
+                                       ldc,
+                                       count,
+                                       computeType,
+                                       algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmBatchedEx_64(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       k,
+                                       one,
+                                       A,
+                                       aType,
+                                       lda,
+                                       B,
+                                       bType,
+                                       ldb,
+                                       zero,
+                                       static_cast<void**>(d),
+                                       hipblas_gemm_ex_datatype(d_type),
+                                       ldd,
+                                       batchCount,
+                                       computeType,
+                                       algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType),
+                                              hipblas_gemm_ex_c_type(cType),
+                                              (void*)C,
+                                              true,
+                                              ldc,
+                                              0,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExWithScalarStride_v2_64(hipblasHandle_t      handle,
+                                                           hipblasOperation_t   transA,
+                                                           hipblasOperation_t   transB,
+                                                           int64_t              m,
+                                                           int64_t              n,
+                                                           int64_t              k,
+                                                           const void*          alpha,
+                                                           hipblasStride        strideAlpha,
+                                                           const void*          A[],
+                                                           hipDataType          aType,
+                                                           int64_t              lda,
+                                                           const void*          B[],
+                                                           hipDataType          bType,
+                                                           int64_t              ldb,
+                                                           const void*          beta,
+                                                           hipblasStride        strideBeta,
+                                                           void*                C[],
+                                                           hipDataType          cType,
+                                                           int64_t              ldc,
+                                                           int64_t              batchCount,
+                                                           hipblasComputeType_t computeType,
+                                                           hipblasGemmAlgo_t    algo)
+try
+{
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        return hipblasGemmBatchedEx_v2_64(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha_i,
+                                          hipblas_grouped_offset(A, first),
+                                          aType,
+                                          lda,
+                                          hipblas_grouped_offset(B, first),
+                                          bType,
+                                          ldb,
+                                          beta_i,
+                                          hipblas_grouped_offset(C, first),
+                                          cType,
+                                          ldc,
+                                          count,
+                                          computeType,
+                                          algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmBatchedEx_v2_64(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          n,
+                                          k,
+                                          one,
+                                          A,
+                                          aType,
+                                          lda,
+                                          B,
+                                          bType,
+                                          ldb,
+                                          zero,
+                                          static_cast<void**>(d),
+                                          d_type,
+                                          ldd,
+                                          batchCount,
+                                          computeType,
+                                          algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType, cType),
+                                              cType,
+                                              (void*)C,
+                                              true,
+                                              ldc,
+                                              0,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScalarStride(hipblasHandle_t    handle,
+                                                            hipblasOperation_t transA,
+                                                            hipblasOperation_t transB,
+                                                            int                m,
+                                                            int                n,
+                                                            int                k,
+                                                            const void*        alpha,
+                                                            hipblasStride      strideAlpha,
+                                                            const void*        A,
+                                                            hipblasDatatype_t  aType,
+                                                            int                lda,
+                                                            hipblasStride      strideA,
+                                                            const void*        B,
+                                                            hipblasDatatype_t  bType,
+                                                            int                ldb,
+                                                            hipblasStride      strideB,
+                                                            const void*        beta,
+                                                            hipblasStride      strideBeta,
+                                                            void*              C,
+                                                            hipblasDatatype_t  cType,
+                                                            int                ldc,
+                                                            hipblasStride      strideC,
+                                                            int                batchCount,
+                                                            hipblasDatatype_t  computeType,
+                                                            hipblasGemmAlgo_t  algo)
+try
+{
+    size_t a_size = hipblas_gemm_ex_element_size(aType);
+    size_t b_size = hipblas_gemm_ex_element_size(bType);
+    size_t c_size = hipblas_gemm_ex_element_size(cType);
+
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        const void* A_i = hipblas_grouped_offset(A, first * strideA, a_size);
+        const void* B_i = hipblas_grouped_offset(B, first * strideB, b_size);
+        void*       C_i = (void*)hipblas_grouped_offset(C, first * strideC, c_size);
+
+        return hipblasGemmStridedBatchedEx(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha_i,
+                                           A_i,
+                                           aType,
+                                           lda,
+                                           strideA,
+                                           B_i,
+                                           bType,
+                                           ldb,
+                                           strideB,
+                                           beta_i,
+                                           C_i,
+                                           cType,
+                                           ldc,
+                                           strideC,
+                                           int(count),
+                                           computeType,
+                                           algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmStridedBatchedEx(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           one,
+                                           A,
+                                           aType,
+                                           lda,
+                                           strideA,
+                                           B,
+                                           bType,
+                                           ldb,
+                                           strideB,
+                                           zero,
+                                           d,
+                                           hipblas_gemm_ex_datatype(d_type),
+                                           int(ldd),
+                                           hipblasStride(m) * n,
+                                           batchCount,
+                                           computeType,
+                                           algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType),
+                                              hipblas_gemm_ex_c_type(cType),
+                                              C,
+                                              false,
+                                              ldc,
+                                              strideC,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScalarStride_v2(hipblasHandle_t      handle,
+                                                               hipblasOperation_t   transA,
+                                                               hipblasOperation_t   transB,
+                                                               int                  m,
+                                                               int                  n,
+                                                               int                  k,
+                                                               const void*          alpha,
+                                                               hipblasStride        strideAlpha,
+                                                               const void*          A,
+                                                               hipDataType          aType,
+                                                               int                  lda,
+                                                               hipblasStride        strideA,
+                                                               const void*          B,
+                                                               hipDataType          bType,
+                                                               int                  ldb,
+                                                               hipblasStride        strideB,
+                                                               const void*          beta,
+                                                               hipblasStride        strideBeta,
+                                                               void*                C,
+                                                               hipDataType          cType,
+                                                               int                  ldc,
+                                                               hipblasStride        strideC,
+                                                               int                  batchCount,
+                                                               hipblasComputeType_t computeType,
+                                                               hipblasGemmAlgo_t    algo)
+try
+{
+    size_t a_size = hipblas_gemm_ex_element_size(aType);
+    size_t b_size = hipblas_gemm_ex_element_size(bType);
+    size_t c_size = hipblas_gemm_ex_element_size(cType);
+
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        const void* A_i = hipblas_grouped_offset(A, first * strideA, a_size);
+        const void* B_i = hipblas_grouped_offset(B, first * strideB, b_size);
+        void*       C_i = (void*)hipblas_grouped_offset(C, first * strideC, c_size);
+
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha_i,
+                                              A_i,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B_i,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              beta_i,
+                                              C_i,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              int(count),
+                                              computeType,
+                                              algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              one,
+                                              A,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              zero,
+                                              d,
+                                              d_type,
+                                              int(ldd),
+                                              hipblasStride(m) * n,
+                                              batchCount,
+                                              computeType,
+                                              algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType, cType),
+                                              cType,
+                                              C,
+                                              false,
+                                              ldc,
+                                              strideC,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScalarStride_64(hipblasHandle_t    handle,
+                                                               hipblasOperation_t transA,
+                                                               hipblasOperation_t transB,
+                                                               int64_t            m,
+                                                               int64_t            n,
+                                                               int64_t            k,
+                                                               const void*        alpha,
+                                                               hipblasStride      strideAlpha,
+                                                               const void*        A,
+                                                               hipblasDatatype_t  aType,
+                                                               int64_t            lda,
+                                                               hipblasStride      strideA,
+                                                               const void*        B,
+                                                               hipblasDatatype_t  bType,
+                                                               int64_t            ldb,
+                                                               hipblasStride      strideB,
+                                                               const void*        beta,
+                                                               hipblasStride      strideBeta,
+                                                               void*              C,
+                                                               hipblasDatatype_t  cType,
+                                                               int64_t            ldc,
+                                                               hipblasStride      strideC,
+                                                               int64_t            batchCount,
+                                                               hipblasDatatype_t  computeType,
+                                                               hipblasGemmAlgo_t  algo)
+try
+{
+    size_t a_size = hipblas_gemm_ex_element_size(aType);
+    size_t b_size = hipblas_gemm_ex_element_size(bType);
+    size_t c_size = hipblas_gemm_ex_element_size(cType);
+
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        const void* A_i = hipblas_grouped_offset(A, first * strideA, a_size);
+        const void* B_i = hipblas_grouped_offset(B, first * strideB, b_size);
+        void*       C_i = (void*)hipblas_grouped_offset(C, first * strideC, c_size);
+
+        return hipblasGemmStridedBatchedEx_64(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha_i,
+                                              A_i,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B_i,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              beta_i,
+                                              C_i,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              count,
+                                              computeType,
+                                              algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmStridedBatchedEx_64(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              n,
+                                              k,
+                                              one,
+                                              A,
+                                              aType,
+                                              lda,
+                                              strideA,
+                                              B,
+                                              bType,
+                                              ldb,
+                                              strideB,
+                                              zero,
+                                              d,
+                                              hipblas_gemm_ex_datatype(d_type),
+                                              ldd,
+                                              hipblasStride(m) * n,
+                                              batchCount,
+                                              computeType,
+                                              algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType),
+                                              hipblas_gemm_ex_c_type(cType),
+                                              C,
+                                              false,
+                                              ldc,
+                                              strideC,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExWithScalarStride_v2_64(hipblasHandle_t      handle,
+                                                                  hipblasOperation_t   transA,
+                                                                  hipblasOperation_t   transB,
+                                                                  int64_t              m,
+                                                                  int64_t              n,
+                                                                  int64_t              k,
+                                                                  const void*          alpha,
+                                                                  hipblasStride        strideAlpha,
+                                                                  const void*          A,
+                                                                  hipDataType          aType,
+                                                                  int64_t              lda,
+                                                                  hipblasStride        strideA,
+                                                                  const void*          B,
+                                                                  hipDataType          bType,
+                                                                  int64_t              ldb,
+                                                                  hipblasStride        strideB,
+                                                                  const void*          beta,
+                                                                  hipblasStride        strideBeta,
+                                                                  void*                C,
+                                                                  hipDataType          cType,
+                                                                  int64_t              ldc,
+                                                                  hipblasStride        strideC,
+                                                                  int64_t              batchCount,
+                                                                  hipblasComputeType_t computeType,
+                                                                  hipblasGemmAlgo_t    algo)
+try
+{
+    size_t a_size = hipblas_gemm_ex_element_size(aType);
+    size_t b_size = hipblas_gemm_ex_element_size(bType);
+    size_t c_size = hipblas_gemm_ex_element_size(cType);
+
+    auto run = [&](int64_t first, int64_t count, const void* alpha_i, const void* beta_i) {
+        const void* A_i = hipblas_grouped_offset(A, first * strideA, a_size);
+        const void* B_i = hipblas_grouped_offset(B, first * strideB, b_size);
+        void*       C_i = (void*)hipblas_grouped_offset(C, first * strideC, c_size);
+
+        return hipblasGemmStridedBatchedEx_v2_64(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha_i,
+                                                 A_i,
+                                                 aType,
+                                                 lda,
+                                                 strideA,
+                                                 B_i,
+                                                 bType,
+                                                 ldb,
+                                                 strideB,
+                                                 beta_i,
+                                                 C_i,
+                                                 cType,
+                                                 ldc,
+                                                 strideC,
+                                                 count,
+                                                 computeType,
+                                                 algo);
+    };
+    auto product = [&](void*       d,
+                       hipDataType d_type,
+                       int64_t     ldd,
+                       const void* one,
+                       const void* zero) {
+        return hipblasGemmStridedBatchedEx_v2_64(handle,
+                                                 transA,
+                                                 transB,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 one,
+                                                 A,
+                                                 aType,
+                                                 lda,
+                                                 strideA,
+                                                 B,
+                                                 bType,
+                                                 ldb,
+                                                 strideB,
+                                                 zero,
+                                                 d,
+                                                 d_type,
+                                                 ldd,
+                                                 hipblasStride(m) * n,
+                                                 batchCount,
+                                                 computeType,
+                                                 algo);
+    };
+    return hipblas_gemm_scalar_stride_execute(handle,
+                                              m,
+                                              n,
+                                              batchCount,
+                                              alpha,
+                                              strideAlpha,
+                                              beta,
+                                              strideBeta,
+                                              hipblas_gemm_ex_scalar_size(computeType, cType),
+                                              cType,
+                                              C,
+                                              false,
+                                              ldc,
+                                              strideC,
+                                              run,
+                                              product);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
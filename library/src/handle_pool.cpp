@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+/*! \brief Pool of handles behind hipblasHandlePool_t.
+ *
+ *  Free handles sit in a fixed array of slots, an empty slot holding nullptr. Acquire and
+ *  Release claim a slot with a single exchange or compare-exchange, so no lock is taken and no
+ *  handle can be handed out twice. Each thread starts its scan at its own slot, which keeps a
+ *  thread on the handle, and so the stream, it used last.
+ */
+struct hipblasHandlePool
+{
+    int                                             device;
+    size_t                                          size;
+    size_t                                          workspace_size;
+    std::unique_ptr<std::atomic<hipblasHandle_t>[]> slots;
+
+    // Modes of a new handle, restored on release; a backend without the mode leaves it alone
+    bool                 reset_math    = false;
+    hipblasMath_t        math          = HIPBLAS_DEFAULT_MATH;
+    bool                 reset_atomics = false;
+    hipblasAtomicsMode_t atomics       = HIPBLAS_ATOMICS_NOT_ALLOWED;
+
+    // Handles checked out and not yet released, extra handles included
+    std::atomic<int64_t> checked_out{0};
+
+    hipblasHandlePool(int device, size_t size, size_t workspace_size)
+        : device(device)
+        , size(size)
+        , workspace_size(workspace_size)
+        , slots(new std::atomic<hipblasHandle_t>[size])
+    {
+        for(size_t i = 0; i < size; i++)
+            slots[i] = nullptr;
+    }
+
+    // Creates a handle with the device memory of the pool already allocated
+    hipblasStatus_t create(hipblasHandle_t* handle)
+    {
+        hipblasStatus_t status = hipblasCreate(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS || !workspace_size)
+            return status;
+
+        status = hipblasPrepareForGraphCapture(*handle, nullptr, nullptr, workspace_size);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetGraphCaptureMode(*handle, HIPBLAS_GRAPH_CAPTURE_DEFAULT);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            hipblasDestroy(*handle);
+        return status;
+    }
+
+    // Puts back the settings a previous user may have changed, so every checkout starts from
+    // the state of a new handle
+    hipblasStatus_t reset(hipblasHandle_t handle, hipblasHandleState* state)
+    {
+        hipblasStatus_t status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status == HIPBLAS_STATUS_SUCCESS && reset_math)
+            status = hipblasSetMathMode(handle, math);
+        if(status == HIPBLAS_STATUS_SUCCESS && reset_atomics)
+            status = hipblasSetAtomicsMode(handle, atomics);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        state->order              = HIPBLAS_ORDER_COLUMN_MAJOR;
+        state->graph_capture_mode = HIPBLAS_GRAPH_CAPTURE_DEFAULT;
+        state->gemm_ex_scale_a    = 1.0f;
+        state->gemm_ex_scale_b    = 1.0f;
+        state->gemm_epilogue_active.store(false, std::memory_order_release);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Destroys the handles still in the pool, returning the first error
+    hipblasStatus_t clear()
+    {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t i = 0; i < size; i++)
+        {
+            hipblasHandle_t handle = slots[i].exchange(nullptr);
+            if(handle)
+            {
+                hipblasStatus_t destroyed = hipblasDestroy(handle);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = destroyed;
+            }
+        }
+        return status;
+    }
+};
+
+namespace
+{
+    size_t hipblasPoolFirstSlot(const hipblasHandlePool* pool)
+    {
+        thread_local size_t thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        return thread_hash % pool->size;
+    }
+
+    bool hipblasPoolOnDevice(const hipblasHandlePool* pool)
+    {
+        int device;
+        return hipGetDevice(&device) == hipSuccess && device == pool->device;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t
+    hipblasHandlePoolCreate(hipblasHandlePool_t* pool, int size, size_t workspaceSizeInBytes)
+try
+{
+    if(!pool || size <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto created = std::make_unique<hipblasHandlePool>(device, size_t(size), workspaceSizeInBytes);
+    for(int i = 0; i < size; i++)
+    {
+        hipblasHandle_t handle;
+        hipblasStatus_t status = created->create(&handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            created->clear();
+            return status;
+        }
+        created->slots[i] = handle;
+
+        if(i == 0)
+        {
+            created->reset_math
+                = hipblasGetMathMode(handle, &created->math) == HIPBLAS_STATUS_SUCCESS;
+            created->reset_atomics
+                = hipblasGetAtomicsMode(handle, &created->atomics) == HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+
+    *pool = created.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(!pool || pool->checked_out != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = pool->clear();
+    delete pool;
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                         hipStream_t         stream,
+                                         hipblasHandle_t*    handle)
+try
+{
+    if(!pool || !handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasPoolOnDevice(pool))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandle_t acquired = nullptr;
+    size_t          first    = hipblasPoolFirstSlot(pool);
+    for(size_t i = 0; i < pool->size && !acquired; i++)
+    {
+        std::atomic<hipblasHandle_t>& slot = pool->slots[(first + i) % pool->size];
+        if(slot.load(std::memory_order_relaxed))
+            acquired = slot.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    // Every pooled handle is checked out; create one more, destroyed when it comes back
+    if(!acquired)
+    {
+        hipblasStatus_t status = pool->create(&acquired);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    hipblasGetHandleState(acquired)->pool.store(pool, std::memory_order_relaxed);
+    pool->checked_out++;
+
+    hipStream_t     current;
+    hipblasStatus_t status = hipblasGetStream(acquired, &current);
+    if(status == HIPBLAS_STATUS_SUCCESS && current != stream)
+        status = hipblasSetStream(acquired, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasHandlePoolRelease(pool, acquired);
+        return status;
+    }
+
+    *handle = acquired;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // Only a handle checked out of this pool, and only once
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    hipblasHandlePool_t owner = pool;
+    if(!state->pool.compare_exchange_strong(owner, nullptr, std::memory_order_relaxed))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    pool->checked_out--;
+
+    hipblasStatus_t status = pool->reset(handle, state);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(handle);
+        return status;
+    }
+
+    size_t first = hipblasPoolFirstSlot(pool);
+    for(size_t i = 0; i < pool->size; i++)
+    {
+        std::atomic<hipblasHandle_t>& slot  = pool->slots[(first + i) % pool->size];
+        hipblasHandle_t               empty = nullptr;
+        if(!slot.load(std::memory_order_relaxed)
+           && slot.compare_exchange_strong(empty, handle, std::memory_order_release))
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The pool is full, so this was an extra handle
+    return hipblasDestroy(handle);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
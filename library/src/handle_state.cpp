@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle_state.hpp"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace
+{
+    struct hipblasHandleRegistry
+    {
+        std::mutex                                                             mutex;
+        std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblasHandleState>> states;
+
+        // Bumped whenever a state is released so per-thread lookups can be revalidated
+        std::atomic<uint64_t> generation{0};
+    };
+
+    // Never destroyed, so handles released during static destruction are still safe
+    hipblasHandleRegistry& hipblasGetHandleRegistry()
+    {
+        static hipblasHandleRegistry* registry = new hipblasHandleRegistry;
+        return *registry;
+    }
+}
+
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle)
+{
+    // Most threads keep using the same handle, so the last lookup is remembered per thread
+    thread_local hipblasHandle_t     last_handle     = nullptr;
+    thread_local hipblasHandleState* last_state      = nullptr;
+    thread_local uint64_t            last_generation = 0;
+
+    hipblasHandleRegistry& registry   = hipblasGetHandleRegistry();
+    uint64_t               generation = registry.generation.load(std::memory_order_acquire);
+    if(last_state && handle == last_handle && generation == last_generation)
+        return last_state;
+
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto& state = registry.states[handle];
+    if(!state)
+        state = std::make_unique<hipblasHandleState>();
+
+    last_handle     = handle;
+    last_state      = state.get();
+    last_generation = registry.generation.load(std::memory_order_relaxed);
+    return last_state;
+}
+
+void hipblasReleaseHandleState(hipblasHandle_t handle)
+{
+    hipblasHandleRegistry&      registry = hipblasGetHandleRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    if(registry.states.erase(handle))
+        registry.generation.fetch_add(1, std::memory_order_release);
+}
+
+bool hipblasGetActiveGemmEpilogue(hipblasHandle_t handle, hipblasGemmEpilogue_t& epilogue)
+{
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    if(!state->gemm_epilogue_active.load(std::memory_order_acquire))
+        return false;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    epilogue = state->gemm_epilogue;
+    return true;
+}
+
+hipblasStatus_t hipblasCheckGemmEpilogue(const hipblasGemmEpilogue_t& epilogue,
+                                         hipDataType                  c_type,
+                                         int64_t                      m)
+{
+    // The bias and aux of a row-major C would run along the columns of the remapped call
+    if(hipblas_row_major_call)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(c_type != HIP_R_16F && c_type != HIP_R_16BF && c_type != HIP_R_32F && c_type != HIP_R_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(epilogue.aux && epilogue.ldAux < std::max(int64_t(1), m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+thread_local bool hipblas_row_major_call = false;
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGraphCaptureMode(hipblasHandle_t handle, hipblasGraphCaptureMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GRAPH_CAPTURE_DEFAULT && mode != HIPBLAS_GRAPH_CAPTURE_SAFE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasGetHandleState(handle)->graph_capture_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGraphCaptureMode(hipblasHandle_t handle, hipblasGraphCaptureMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblasGetHandleState(handle)->graph_capture_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSetOrder(hipblasHandle_t handle, hipblasOrder_t order)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(order != HIPBLAS_ORDER_COLUMN_MAJOR && order != HIPBLAS_ORDER_ROW_MAJOR)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasGetHandleState(handle)->order = order;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetOrder(hipblasHandle_t handle, hipblasOrder_t* order)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!order)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *order = hipblasGetHandleState(handle)->order;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSetGemmExScales(hipblasHandle_t handle, float scaleA, float scaleB)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    state->gemm_ex_scale_a    = scaleA;
+    state->gemm_ex_scale_b    = scaleB;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmExScales(hipblasHandle_t handle, float* scaleA, float* scaleB)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!scaleA || !scaleB)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle);
+    *scaleA                   = state->gemm_ex_scale_a;
+    *scaleB                   = state->gemm_ex_scale_b;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSetGemmEpilogue(hipblasHandle_t              handle,
+                                       const hipblasGemmEpilogue_t* epilogue)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasGemmEpilogue_t none{};
+    if(!epilogue)
+        epilogue = &none;
+    if(epilogue->activation != HIPBLAS_GEMM_ACTIVATION_NONE
+       && epilogue->activation != HIPBLAS_GEMM_ACTIVATION_RELU
+       && epilogue->activation != HIPBLAS_GEMM_ACTIVATION_GELU)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(epilogue->strideBias < 0 || epilogue->strideAux < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->gemm_epilogue = *epilogue;
+    state->gemm_epilogue_active.store(epilogue->activation != HIPBLAS_GEMM_ACTIVATION_NONE
+                                          || epilogue->bias || epilogue->aux,
+                                      std::memory_order_release);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmEpilogue(hipblasHandle_t handle, hipblasGemmEpilogue_t* epilogue)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!epilogue)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    *epilogue = state->gemm_epilogue;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
@@ -0,0 +1,575 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bytes.hpp"
+#include "exceptions.hpp"
+#include "flops.hpp"
+#include "handle_state.hpp"
+#include "logging.hpp"
+#include <cctype>
+#include <cstring>
+#include <set>
+#include <vector>
+
+namespace
+{
+    // Routines with flop and byte counts, named by the function prefix of hipblas-bench
+    enum class hipblasStatsRoutine
+    {
+        none,
+        asum,
+        axpy,
+        copy,
+        dot,
+        dotc,
+        iamax,
+        nrm2,
+        rot,
+        rotm,
+        scal,
+        swap,
+        gbmv,
+        gemv,
+        ger,
+        hbmv,
+        hemv,
+        her,
+        her2,
+        hpmv,
+        hpr,
+        hpr2,
+        sbmv,
+        spmv,
+        spr,
+        spr2,
+        symv,
+        syr,
+        syr2,
+        tbmv,
+        tbsv,
+        tpmv,
+        tpsv,
+        trmv,
+        trsv,
+        dgmm,
+        geam,
+        gemm,
+        hemm,
+        herk,
+        her2k,
+        herkx,
+        symm,
+        syrk,
+        syr2k,
+        syrkx,
+        trmm,
+        trsm,
+        trtri,
+        geqrf,
+        getrf,
+        getri,
+        getrs,
+        gels,
+    };
+
+    constexpr struct
+    {
+        const char*         name;
+        hipblasStatsRoutine routine;
+    } hipblas_stats_routines[] = {
+        {"asum", hipblasStatsRoutine::asum},   {"axpy", hipblasStatsRoutine::axpy},
+        {"copy", hipblasStatsRoutine::copy},   {"dot", hipblasStatsRoutine::dot},
+        {"dotc", hipblasStatsRoutine::dotc},   {"iamax", hipblasStatsRoutine::iamax},
+        {"iamin", hipblasStatsRoutine::iamax}, {"nrm2", hipblasStatsRoutine::nrm2},
+        {"rot", hipblasStatsRoutine::rot},     {"rotm", hipblasStatsRoutine::rotm},
+        {"scal", hipblasStatsRoutine::scal},   {"swap", hipblasStatsRoutine::swap},
+        {"gbmv", hipblasStatsRoutine::gbmv},   {"gemv", hipblasStatsRoutine::gemv},
+        {"ger", hipblasStatsRoutine::ger},     {"geru", hipblasStatsRoutine::ger},
+        {"gerc", hipblasStatsRoutine::ger},    {"hbmv", hipblasStatsRoutine::hbmv},
+        {"hemv", hipblasStatsRoutine::hemv},   {"her", hipblasStatsRoutine::her},
+        {"her2", hipblasStatsRoutine::her2},   {"hpmv", hipblasStatsRoutine::hpmv},
+        {"hpr", hipblasStatsRoutine::hpr},     {"hpr2", hipblasStatsRoutine::hpr2},
+        {"sbmv", hipblasStatsRoutine::sbmv},   {"spmv", hipblasStatsRoutine::spmv},
+        {"spr", hipblasStatsRoutine::spr},     {"spr2", hipblasStatsRoutine::spr2},
+        {"symv", hipblasStatsRoutine::symv},   {"syr", hipblasStatsRoutine::syr},
+        {"syr2", hipblasStatsRoutine::syr2},   {"tbmv", hipblasStatsRoutine::tbmv},
+        {"tbsv", hipblasStatsRoutine::tbsv},   {"tpmv", hipblasStatsRoutine::tpmv},
+        {"tpsv", hipblasStatsRoutine::tpsv},   {"trmv", hipblasStatsRoutine::trmv},
+        {"trsv", hipblasStatsRoutine::trsv},   {"dgmm", hipblasStatsRoutine::dgmm},
+        {"geam", hipblasStatsRoutine::geam},   {"gemm", hipblasStatsRoutine::gemm},
+        {"hemm", hipblasStatsRoutine::hemm},   {"herk", hipblasStatsRoutine::herk},
+        {"her2k", hipblasStatsRoutine::her2k}, {"herkx", hipblasStatsRoutine::herkx},
+        {"symm", hipblasStatsRoutine::symm},   {"syrk", hipblasStatsRoutine::syrk},
+        {"syr2k", hipblasStatsRoutine::syr2k}, {"syrkx", hipblasStatsRoutine::syrkx},
+        {"trmm", hipblasStatsRoutine::trmm},   {"trsm", hipblasStatsRoutine::trsm},
+        {"trtri", hipblasStatsRoutine::trtri}, {"geqrf", hipblasStatsRoutine::geqrf},
+        {"getrf", hipblasStatsRoutine::getrf}, {"getri", hipblasStatsRoutine::getri},
+        {"getrs", hipblasStatsRoutine::getrs}, {"gels", hipblasStatsRoutine::gels},
+    };
+
+    // Routine of function without the batched, ex and no-pivoting variants, e.g. gemm for
+    // gemm_strided_batched_ex
+    hipblasStatsRoutine hipblasStatsRoutineOf(const char* function)
+    {
+        size_t length = strcspn(function, "_");
+        for(const auto& entry : hipblas_stats_routines)
+            if(strlen(entry.name) == length && !strncmp(entry.name, function, length))
+                return entry.routine;
+        return hipblasStatsRoutine::none;
+    }
+
+    // Arguments of a logged call that the flop and byte counts depend on
+    struct hipblasCallShape
+    {
+        const char*         function    = nullptr;
+        hipblasStatsRoutine routine     = hipblasStatsRoutine::none;
+        const char*         precision   = "f32_r";
+        const char*         b_type      = "";
+        int64_t             m           = 0;
+        int64_t             n           = 0;
+        int64_t             k           = 0;
+        int64_t             kl          = 0;
+        int64_t             ku          = 0;
+        int64_t             batch_count = 1;
+        char                trans_a     = 'N';
+        char                side        = 'L';
+    };
+
+    // Member of hipblasCallShape set by an option of a hipblas-bench command line
+    enum class hipblasStatsField : uint8_t
+    {
+        none,
+        function,
+        precision,
+        b_type,
+        m,
+        n,
+        k,
+        kl,
+        ku,
+        batch_count,
+        trans_a,
+        side,
+    };
+
+    hipblasStatsField hipblasStatsFieldOf(const std::string& option)
+    {
+        static const std::pair<const char*, hipblasStatsField> options[] = {
+            {"-f", hipblasStatsField::function},
+            {"-r", hipblasStatsField::precision},
+            {"--b_type", hipblasStatsField::b_type},
+            {"-m", hipblasStatsField::m},
+            {"-n", hipblasStatsField::n},
+            {"-k", hipblasStatsField::k},
+            {"--kl", hipblasStatsField::kl},
+            {"--ku", hipblasStatsField::ku},
+            {"--batch_count", hipblasStatsField::batch_count},
+            {"--transposeA", hipblasStatsField::trans_a},
+            {"--side", hipblasStatsField::side},
+        };
+        for(const auto& entry : options)
+            if(option == entry.first)
+                return entry.second;
+        return hipblasStatsField::none;
+    }
+
+    void hipblasSetShapeField(hipblasCallShape&        c,
+                              hipblasStatsField        field,
+                              const hipblas_log_value& value)
+    {
+        switch(field)
+        {
+        case hipblasStatsField::function:
+            if(value.text)
+                c.function = value.text;
+            break;
+        case hipblasStatsField::precision:
+            if(value.text)
+                c.precision = value.text;
+            break;
+        case hipblasStatsField::b_type:
+            if(value.text)
+                c.b_type = value.text;
+            break;
+        case hipblasStatsField::m:
+            c.m = value.number;
+            break;
+        case hipblasStatsField::n:
+            c.n = value.number;
+            break;
+        case hipblasStatsField::k:
+            c.k = value.number;
+            break;
+        case hipblasStatsField::kl:
+            c.kl = value.number;
+            break;
+        case hipblasStatsField::ku:
+            c.ku = value.number;
+            break;
+        case hipblasStatsField::batch_count:
+            c.batch_count = value.number;
+            break;
+        case hipblasStatsField::trans_a:
+            if(value.text)
+                c.trans_a = value.text[0];
+            break;
+        case hipblasStatsField::side:
+            if(value.text)
+                c.side = value.text[0];
+            break;
+        case hipblasStatsField::none:
+            break;
+        }
+    }
+
+    // Copy of text that lives as long as the library, for the values written into a format
+    const char* hipblasStatsIntern(const std::string& text)
+    {
+        static std::mutex            mutex;
+        static std::set<std::string> texts;
+        std::lock_guard<std::mutex>  lock(mutex);
+        return texts.insert(text).first->c_str();
+    }
+
+    /*! \brief What the stats layer reads from a hipblas-bench format.
+     *
+     *  Built once per format and thread: literals holds the values written into the format,
+     *  such as the routine and usually the precision, and fields the member each {} sets, in
+     *  order. Arguments that are not sizes, types or operations map to none.
+     */
+    struct hipblasCallLayout
+    {
+        hipblasCallShape               literals;
+        std::vector<hipblasStatsField> fields;
+
+        explicit hipblasCallLayout(const char* format)
+        {
+            hipblasStatsField option = hipblasStatsField::none;
+            for(const char* c = format; *c;)
+            {
+                if(*c == ' ')
+                {
+                    c++;
+                    continue;
+                }
+                size_t            length = strcspn(c, " ");
+                const std::string token(c, length);
+                c += length;
+
+                if(token.find("{}") != std::string::npos)
+                {
+                    for(size_t pos = token.find("{}"); pos != std::string::npos;
+                        pos        = token.find("{}", pos + 2))
+                        fields.push_back(token == "{}" ? option : hipblasStatsField::none);
+                    option = hipblasStatsField::none;
+                }
+                else if(token[0] == '-' && !isdigit(token[1]))
+                    option = hipblasStatsFieldOf(token);
+                else if(option != hipblasStatsField::none)
+                {
+                    hipblas_log_value value;
+                    value.text   = hipblasStatsIntern(token);
+                    value.number = strtoll(token.c_str(), nullptr, 10);
+                    hipblasSetShapeField(literals, option, value);
+                    option = hipblasStatsField::none;
+                }
+            }
+            if(literals.function)
+                literals.routine = hipblasStatsRoutineOf(literals.function);
+        }
+    };
+
+    const hipblasCallLayout& hipblasGetCallLayout(const char* format)
+    {
+        // Formats are string literals, so their address identifies them
+        thread_local std::unordered_map<const char*, hipblasCallLayout> layouts;
+
+        auto found = layouts.find(format);
+        if(found == layouts.end())
+            found = layouts.emplace(format, hipblasCallLayout(format)).first;
+        return found->second;
+    }
+
+    /*! \brief Estimated flops and bytes, in billions, of one instance of a call.
+     *
+     *  T is the element type, standing in for the type of the same size for 16-bit and integer
+     *  types; R is its real type. Uses the counts of flops.hpp and bytes.hpp that hipblas-bench
+     *  reports, with the arguments the matching test passes. Routines without counts, such as
+     *  rotg or the auxiliary functions, count as 0.
+     */
+    template <typename T, typename R>
+    std::pair<double, double> hipblasCallCost(const hipblasCallShape& c)
+    {
+        hipblasOperation_t trans = c.trans_a == 'T'   ? HIPBLAS_OP_T
+                                   : c.trans_a == 'C' ? HIPBLAS_OP_C
+                                                      : HIPBLAS_OP_N;
+        int64_t            m     = c.m;
+        int64_t            n     = c.n;
+        int64_t            k     = c.k;
+        int64_t            dim_a = c.side == 'L' ? m : n;
+        bool               real_scalar
+            = !std::is_same<T, R>{} && (!strcmp(c.b_type, "f32_r") || !strcmp(c.b_type, "f64_r"));
+
+        switch(c.routine)
+        {
+        case hipblasStatsRoutine::asum:
+            return {asum_gflop_count<T>(n), asum_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::axpy:
+            return {axpy_gflop_count<T>(n), axpy_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::copy:
+            return {copy_gflop_count<T>(n), copy_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::dot:
+            return {dot_gflop_count<false, T>(n), dot_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::dotc:
+            return {dot_gflop_count<true, T>(n), dot_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::iamax:
+            return {iamax_gflop_count<T>(n), iamax_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::nrm2:
+            return {nrm2_gflop_count<T>(n), nrm2_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::rot:
+            return {rot_gflop_count<T, T, R, R>(n), rot_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::rotm: // the flag is in device or host memory; count the general case
+            if constexpr(std::is_same<T, R>{})
+                return {rotm_gflop_count<T>(n, T(-1)), rotm_gbyte_count<T>(n, T(-1))};
+            break;
+        case hipblasStatsRoutine::scal:
+            return {real_scalar ? scal_gflop_count<T, R>(n) : scal_gflop_count<T, T>(n),
+                    scal_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::swap:
+            return {swap_gflop_count<T>(n), swap_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::gbmv:
+            return {gbmv_gflop_count<T>(trans, m, n, c.kl, c.ku),
+                    gbmv_gbyte_count<T>(trans, m, n, c.kl, c.ku)};
+        case hipblasStatsRoutine::gemv:
+            return {gemv_gflop_count<T>(trans, m, n), gemv_gbyte_count<T>(trans, m, n)};
+        case hipblasStatsRoutine::ger:
+            return {ger_gflop_count<T>(m, n), ger_gbyte_count<T>(m, n)};
+        case hipblasStatsRoutine::hbmv:
+            return {hbmv_gflop_count<T>(n, k), hbmv_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::hemv:
+            return {hemv_gflop_count<T>(n), hemv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::her:
+            return {her_gflop_count<T>(n), her_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::her2:
+            return {her2_gflop_count<T>(n), her2_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::hpmv:
+            return {hpmv_gflop_count<T>(n), hpmv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::hpr:
+            return {hpr_gflop_count<T>(n), hpr_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::hpr2:
+            return {hpr2_gflop_count<T>(n), hpr2_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::sbmv:
+            return {sbmv_gflop_count<T>(n, k), sbmv_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::spmv:
+            return {spmv_gflop_count<T>(n), spmv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::spr:
+            return {spr_gflop_count<T>(n), spr_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::spr2:
+            return {spr2_gflop_count<T>(n), spr2_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::symv:
+            return {symv_gflop_count<T>(n), symv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::syr:
+            return {syr_gflop_count<T>(n), syr_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::syr2:
+            return {syr2_gflop_count<T>(n), syr2_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::tbmv:
+            return {tbmv_gflop_count<T>(m, k), tbmv_gbyte_count<T>(m, k)};
+        case hipblasStatsRoutine::tbsv:
+            return {tbsv_gflop_count<T>(n, k), tbsv_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::tpmv:
+            return {tpmv_gflop_count<T>(n), tpmv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::tpsv:
+            return {tpsv_gflop_count<T>(n), tpsv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::trmv:
+            return {trmv_gflop_count<T>(n), trmv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::trsv:
+            return {trsv_gflop_count<T>(n), trsv_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::dgmm:
+            return {dgmm_gflop_count<T>(m, n), dgmm_gbyte_count<T>(m, n, dim_a)};
+        case hipblasStatsRoutine::geam:
+            return {geam_gflop_count<T>(m, n), geam_gbyte_count<T>(m, n)};
+        case hipblasStatsRoutine::gemm:
+            return {gemm_gflop_count<T>(m, n, k), gemm_gbyte_count<T>(m, n, k)};
+        case hipblasStatsRoutine::hemm:
+            return {hemm_gflop_count<T>(m, n, dim_a), hemm_gbyte_count<T>(m, n, dim_a)};
+        case hipblasStatsRoutine::herk:
+            return {herk_gflop_count<T>(n, k), herk_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::her2k:
+            return {her2k_gflop_count<T>(n, k), her2k_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::herkx:
+            return {herkx_gflop_count<T>(n, k), herkx_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::symm:
+            return {symm_gflop_count<T>(m, n, dim_a), symm_gbyte_count<T>(m, n, dim_a)};
+        case hipblasStatsRoutine::syrk:
+            return {syrk_gflop_count<T>(n, k), syrk_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::syr2k:
+            return {syr2k_gflop_count<T>(n, k), syr2k_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::syrkx:
+            return {syrkx_gflop_count<T>(n, k), syrkx_gbyte_count<T>(n, k)};
+        case hipblasStatsRoutine::trmm:
+            return {trmm_gflop_count<T>(m, n, dim_a), trmm_gbyte_count<T>(m, n, dim_a)};
+        case hipblasStatsRoutine::trsm:
+            return {trsm_gflop_count<T>(m, n, dim_a), trsm_gbyte_count<T>(m, n, dim_a)};
+        case hipblasStatsRoutine::trtri:
+            return {trtri_gflop_count<T>(n), trtri_gbyte_count<T>(n)};
+        case hipblasStatsRoutine::geqrf:
+            return {geqrf_gflop_count<T>(n, m), 0};
+        case hipblasStatsRoutine::getrf:
+            return {getrf_gflop_count<T>(n, n), 0};
+        case hipblasStatsRoutine::getri:
+            return {getri_gflop_count<T>(n), 0};
+        case hipblasStatsRoutine::getrs:
+            return {getrs_gflop_count<T>(n, 1), 0};
+        case hipblasStatsRoutine::gels:
+            return {gels_gflop_count<T>(m, n), 0};
+        case hipblasStatsRoutine::none:
+            break;
+        }
+        return {0, 0};
+    }
+
+    // Flops and bytes of all instances of a call
+    std::pair<double, double> hipblasShapeCost(const hipblasCallShape& c)
+    {
+        const char*               r    = c.precision;
+        std::pair<double, double> cost = {0, 0};
+        if(!strcmp(r, "f32_r"))
+            cost = hipblasCallCost<float, float>(c);
+        else if(!strcmp(r, "f64_r"))
+            cost = hipblasCallCost<double, double>(c);
+        else if(!strcmp(r, "f32_c"))
+            cost = hipblasCallCost<hipblasComplex, float>(c);
+        else if(!strcmp(r, "f64_c"))
+            cost = hipblasCallCost<hipblasDoubleComplex, double>(c);
+        else if(!strcmp(r, "f16_r") || !strcmp(r, "bf16_r"))
+            cost = hipblasCallCost<uint16_t, uint16_t>(c);
+        else if(!strcmp(r, "i8_r"))
+            cost = hipblasCallCost<int8_t, int8_t>(c);
+        else if(!strcmp(r, "i32_r"))
+            cost = hipblasCallCost<int32_t, int32_t>(c);
+
+        return {cost.first * c.batch_count, cost.second * c.batch_count};
+    }
+}
+
+void hipblasHandleStatsCount(hipblasCallStats&       stats,
+                             const char*             format,
+                             const hipblas_log_value values[],
+                             size_t                  count)
+{
+    const hipblasCallLayout& layout = hipblasGetCallLayout(format);
+
+    hipblasCallShape c = layout.literals;
+    for(size_t i = 0; i < count && i < layout.fields.size(); i++)
+        hipblasSetShapeField(c, layout.fields[i], values[i]);
+    if(!c.function)
+        return;
+    if(c.function != layout.literals.function)
+        c.routine = hipblasStatsRoutineOf(c.function);
+
+    auto cost = hipblasShapeCost(c);
+    if(!stats.function)
+    {
+        stats.function  = c.function;
+        stats.precision = c.precision;
+    }
+    stats.gflops += cost.first;
+    stats.gbytes += cost.second;
+}
+
+void hipblasHandleStatsAdd(hipblasHandle_t handle, const hipblasCallStats& stats, uint64_t host_ns)
+{
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    hipblasRoutineCounters& counters = state->routine_stats[{stats.function, stats.precision}];
+    counters.calls++;
+    counters.host_ns += host_ns;
+    counters.gflops += stats.gflops;
+    counters.gbytes += stats.gbytes;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGetHandleStats(hipblasHandle_t        handle,
+                                      hipblasRoutineStats_t* stats,
+                                      int*                   count,
+                                      uint64_t*              workspaceReallocations)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!count || (stats && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    if(workspaceReallocations)
+        *workspaceReallocations = state->workspace_reallocations;
+
+    if(!stats)
+    {
+        *count = int(state->routine_stats.size());
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int filled = 0;
+    for(const auto& entry : state->routine_stats)
+    {
+        if(filled == *count)
+            break;
+        hipblasRoutineStats_t& out = stats[filled++];
+        snprintf(out.routine, sizeof(out.routine), "%s", entry.first.first);
+        snprintf(out.precision, sizeof(out.precision), "%s", entry.first.second);
+        out.calls      = entry.second.calls;
+        out.hostTimeUs = entry.second.host_ns / 1e3;
+        out.gflops     = entry.second.gflops;
+        out.gbytes     = entry.second.gbytes;
+    }
+    *count = filled;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasResetHandleStats(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->routine_stats.clear();
+    state->workspace_reallocations = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
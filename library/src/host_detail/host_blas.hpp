@@ -0,0 +1,352 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas.h"
+#include <complex>
+#include <cstdint>
+
+/*!\file
+ * \brief Typed overloads over the CBLAS and Fortran LAPACK interfaces used by the host backend.
+ * All matrices are column major; complex types are std::complex which is layout compatible
+ * with hipblasComplex, hipblasDoubleComplex, hipComplex and hipDoubleComplex.
+ */
+
+#ifdef FLA_ENABLE_ILP64
+typedef int64_t host_blas_int;
+#else
+typedef int host_blas_int;
+#endif
+
+typedef std::complex<float>  host_complex;
+typedef std::complex<double> host_double_complex;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+void sgetrf_(host_blas_int* m, host_blas_int* n, float* A, host_blas_int* lda, host_blas_int* ipiv, host_blas_int* info);
+void dgetrf_(host_blas_int* m, host_blas_int* n, double* A, host_blas_int* lda, host_blas_int* ipiv, host_blas_int* info);
+void cgetrf_(host_blas_int* m, host_blas_int* n, host_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_blas_int* info);
+void zgetrf_(host_blas_int* m, host_blas_int* n, host_double_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_blas_int* info);
+
+void sgetrs_(char* trans, host_blas_int* n, host_blas_int* nrhs, float* A, host_blas_int* lda, host_blas_int* ipiv, float* B, host_blas_int* ldb, host_blas_int* info);
+void dgetrs_(char* trans, host_blas_int* n, host_blas_int* nrhs, double* A, host_blas_int* lda, host_blas_int* ipiv, double* B, host_blas_int* ldb, host_blas_int* info);
+void cgetrs_(char* trans, host_blas_int* n, host_blas_int* nrhs, host_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_complex* B, host_blas_int* ldb, host_blas_int* info);
+void zgetrs_(char* trans, host_blas_int* n, host_blas_int* nrhs, host_double_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_double_complex* B, host_blas_int* ldb, host_blas_int* info);
+
+void sgetri_(host_blas_int* n, float* A, host_blas_int* lda, host_blas_int* ipiv, float* work, host_blas_int* lwork, host_blas_int* info);
+void dgetri_(host_blas_int* n, double* A, host_blas_int* lda, host_blas_int* ipiv, double* work, host_blas_int* lwork, host_blas_int* info);
+void cgetri_(host_blas_int* n, host_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_complex* work, host_blas_int* lwork, host_blas_int* info);
+void zgetri_(host_blas_int* n, host_double_complex* A, host_blas_int* lda, host_blas_int* ipiv, host_double_complex* work, host_blas_int* lwork, host_blas_int* info);
+
+void sgeqrf_(host_blas_int* m, host_blas_int* n, float* A, host_blas_int* lda, float* tau, float* work, host_blas_int* lwork, host_blas_int* info);
+void dgeqrf_(host_blas_int* m, host_blas_int* n, double* A, host_blas_int* lda, double* tau, double* work, host_blas_int* lwork, host_blas_int* info);
+void cgeqrf_(host_blas_int* m, host_blas_int* n, host_complex* A, host_blas_int* lda, host_complex* tau, host_complex* work, host_blas_int* lwork, host_blas_int* info);
+void zgeqrf_(host_blas_int* m, host_blas_int* n, host_double_complex* A, host_blas_int* lda, host_double_complex* tau, host_double_complex* work, host_blas_int* lwork, host_blas_int* info);
+
+void sgels_(char* trans, host_blas_int* m, host_blas_int* n, host_blas_int* nrhs, float* A, host_blas_int* lda, float* B, host_blas_int* ldb, float* work, host_blas_int* lwork, host_blas_int* info);
+void dgels_(char* trans, host_blas_int* m, host_blas_int* n, host_blas_int* nrhs, double* A, host_blas_int* lda, double* B, host_blas_int* ldb, double* work, host_blas_int* lwork, host_blas_int* info);
+void cgels_(char* trans, host_blas_int* m, host_blas_int* n, host_blas_int* nrhs, host_complex* A, host_blas_int* lda, host_complex* B, host_blas_int* ldb, host_complex* work, host_blas_int* lwork, host_blas_int* info);
+void zgels_(char* trans, host_blas_int* m, host_blas_int* n, host_blas_int* nrhs, host_double_complex* A, host_blas_int* lda, host_double_complex* B, host_blas_int* ldb, host_double_complex* work, host_blas_int* lwork, host_blas_int* info);
+
+void strtri_(char* uplo, char* diag, host_blas_int* n, float* A, host_blas_int* lda, host_blas_int* info);
+void dtrtri_(char* uplo, char* diag, host_blas_int* n, double* A, host_blas_int* lda, host_blas_int* info);
+void ctrtri_(char* uplo, char* diag, host_blas_int* n, host_complex* A, host_blas_int* lda, host_blas_int* info);
+void ztrtri_(char* uplo, char* diag, host_blas_int* n, host_double_complex* A, host_blas_int* lda, host_blas_int* info);
+// clang-format on
+
+#ifdef __cplusplus
+}
+#endif
+
+/*
+ * ===========================================================================
+ *    level 1 BLAS
+ * ===========================================================================
+ */
+
+// clang-format off
+inline host_blas_int host_iamax(host_blas_int n, const float* x, host_blas_int incx) { return host_blas_int(cblas_isamax(n, x, incx)); }
+inline host_blas_int host_iamax(host_blas_int n, const double* x, host_blas_int incx) { return host_blas_int(cblas_idamax(n, x, incx)); }
+inline host_blas_int host_iamax(host_blas_int n, const host_complex* x, host_blas_int incx) { return host_blas_int(cblas_icamax(n, x, incx)); }
+inline host_blas_int host_iamax(host_blas_int n, const host_double_complex* x, host_blas_int incx) { return host_blas_int(cblas_izamax(n, x, incx)); }
+
+inline float  host_asum(host_blas_int n, const float* x, host_blas_int incx) { return cblas_sasum(n, x, incx); }
+inline double host_asum(host_blas_int n, const double* x, host_blas_int incx) { return cblas_dasum(n, x, incx); }
+inline float  host_asum(host_blas_int n, const host_complex* x, host_blas_int incx) { return cblas_scasum(n, x, incx); }
+inline double host_asum(host_blas_int n, const host_double_complex* x, host_blas_int incx) { return cblas_dzasum(n, x, incx); }
+
+inline float  host_nrm2(host_blas_int n, const float* x, host_blas_int incx) { return cblas_snrm2(n, x, incx); }
+inline double host_nrm2(host_blas_int n, const double* x, host_blas_int incx) { return cblas_dnrm2(n, x, incx); }
+inline float  host_nrm2(host_blas_int n, const host_complex* x, host_blas_int incx) { return cblas_scnrm2(n, x, incx); }
+inline double host_nrm2(host_blas_int n, const host_double_complex* x, host_blas_int incx) { return cblas_dznrm2(n, x, incx); }
+
+inline void host_axpy(host_blas_int n, float alpha, const float* x, host_blas_int incx, float* y, host_blas_int incy) { cblas_saxpy(n, alpha, x, incx, y, incy); }
+inline void host_axpy(host_blas_int n, double alpha, const double* x, host_blas_int incx, double* y, host_blas_int incy) { cblas_daxpy(n, alpha, x, incx, y, incy); }
+inline void host_axpy(host_blas_int n, host_complex alpha, const host_complex* x, host_blas_int incx, host_complex* y, host_blas_int incy) { cblas_caxpy(n, &alpha, x, incx, y, incy); }
+inline void host_axpy(host_blas_int n, host_double_complex alpha, const host_double_complex* x, host_blas_int incx, host_double_complex* y, host_blas_int incy) { cblas_zaxpy(n, &alpha, x, incx, y, incy); }
+
+inline void host_copy(host_blas_int n, const float* x, host_blas_int incx, float* y, host_blas_int incy) { cblas_scopy(n, x, incx, y, incy); }
+inline void host_copy(host_blas_int n, const double* x, host_blas_int incx, double* y, host_blas_int incy) { cblas_dcopy(n, x, incx, y, incy); }
+inline void host_copy(host_blas_int n, const host_complex* x, host_blas_int incx, host_complex* y, host_blas_int incy) { cblas_ccopy(n, x, incx, y, incy); }
+inline void host_copy(host_blas_int n, const host_double_complex* x, host_blas_int incx, host_double_complex* y, host_blas_int incy) { cblas_zcopy(n, x, incx, y, incy); }
+
+inline void host_swap(host_blas_int n, float* x, host_blas_int incx, float* y, host_blas_int incy) { cblas_sswap(n, x, incx, y, incy); }
+inline void host_swap(host_blas_int n, double* x, host_blas_int incx, double* y, host_blas_int incy) { cblas_dswap(n, x, incx, y, incy); }
+inline void host_swap(host_blas_int n, host_complex* x, host_blas_int incx, host_complex* y, host_blas_int incy) { cblas_cswap(n, x, incx, y, incy); }
+inline void host_swap(host_blas_int n, host_double_complex* x, host_blas_int incx, host_double_complex* y, host_blas_int incy) { cblas_zswap(n, x, incx, y, incy); }
+
+inline void host_scal(host_blas_int n, float alpha, float* x, host_blas_int incx) { cblas_sscal(n, alpha, x, incx); }
+inline void host_scal(host_blas_int n, double alpha, double* x, host_blas_int incx) { cblas_dscal(n, alpha, x, incx); }
+inline void host_scal(host_blas_int n, host_complex alpha, host_complex* x, host_blas_int incx) { cblas_cscal(n, &alpha, x, incx); }
+inline void host_scal(host_blas_int n, host_double_complex alpha, host_double_complex* x, host_blas_int incx) { cblas_zscal(n, &alpha, x, incx); }
+inline void host_scal(host_blas_int n, float alpha, host_complex* x, host_blas_int incx) { cblas_csscal(n, alpha, x, incx); }
+inline void host_scal(host_blas_int n, double alpha, host_double_complex* x, host_blas_int incx) { cblas_zdscal(n, alpha, x, incx); }
+
+inline float  host_dot(host_blas_int n, const float* x, host_blas_int incx, const float* y, host_blas_int incy) { return cblas_sdot(n, x, incx, y, incy); }
+inline double host_dot(host_blas_int n, const double* x, host_blas_int incx, const double* y, host_blas_int incy) { return cblas_ddot(n, x, incx, y, incy); }
+inline host_complex host_dot(host_blas_int n, const host_complex* x, host_blas_int incx, const host_complex* y, host_blas_int incy) { host_complex r; cblas_cdotu_sub(n, x, incx, y, incy, &r); return r; }
+inline host_double_complex host_dot(host_blas_int n, const host_double_complex* x, host_blas_int incx, const host_double_complex* y, host_blas_int incy) { host_double_complex r; cblas_zdotu_sub(n, x, incx, y, incy, &r); return r; }
+
+inline float  host_dotc(host_blas_int n, const float* x, host_blas_int incx, const float* y, host_blas_int incy) { return cblas_sdot(n, x, incx, y, incy); }
+inline double host_dotc(host_blas_int n, const double* x, host_blas_int incx, const double* y, host_blas_int incy) { return cblas_ddot(n, x, incx, y, incy); }
+inline host_complex host_dotc(host_blas_int n, const host_complex* x, host_blas_int incx, const host_complex* y, host_blas_int incy) { host_complex r; cblas_cdotc_sub(n, x, incx, y, incy, &r); return r; }
+inline host_double_complex host_dotc(host_blas_int n, const host_double_complex* x, host_blas_int incx, const host_double_complex* y, host_blas_int incy) { host_double_complex r; cblas_zdotc_sub(n, x, incx, y, incy, &r); return r; }
+
+inline void host_rot(host_blas_int n, float* x, host_blas_int incx, float* y, host_blas_int incy, float c, float s) { cblas_srot(n, x, incx, y, incy, c, s); }
+inline void host_rot(host_blas_int n, double* x, host_blas_int incx, double* y, host_blas_int incy, double c, double s) { cblas_drot(n, x, incx, y, incy, c, s); }
+
+inline void host_rotg(float* a, float* b, float* c, float* s) { cblas_srotg(a, b, c, s); }
+inline void host_rotg(double* a, double* b, double* c, double* s) { cblas_drotg(a, b, c, s); }
+
+inline void host_rotm(host_blas_int n, float* x, host_blas_int incx, float* y, host_blas_int incy, const float* param) { cblas_srotm(n, x, incx, y, incy, param); }
+inline void host_rotm(host_blas_int n, double* x, host_blas_int incx, double* y, host_blas_int incy, const double* param) { cblas_drotm(n, x, incx, y, incy, param); }
+
+inline void host_rotmg(float* d1, float* d2, float* x1, float y1, float* param) { cblas_srotmg(d1, d2, x1, y1, param); }
+inline void host_rotmg(double* d1, double* d2, double* x1, double y1, double* param) { cblas_drotmg(d1, d2, x1, y1, param); }
+
+/*
+ * ===========================================================================
+ *    level 2 BLAS
+ * ===========================================================================
+ */
+
+#define HOST_GEMV_ARGS(T, S) CBLAS_TRANSPOSE trans, host_blas_int m, host_blas_int n, S alpha, const T* A, host_blas_int lda, const T* x, host_blas_int incx, S beta, T* y, host_blas_int incy
+inline void host_gemv(HOST_GEMV_ARGS(float, float)) { cblas_sgemv(CblasColMajor, trans, m, n, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_gemv(HOST_GEMV_ARGS(double, double)) { cblas_dgemv(CblasColMajor, trans, m, n, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_gemv(HOST_GEMV_ARGS(host_complex, host_complex)) { cblas_cgemv(CblasColMajor, trans, m, n, &alpha, A, lda, x, incx, &beta, y, incy); }
+inline void host_gemv(HOST_GEMV_ARGS(host_double_complex, host_double_complex)) { cblas_zgemv(CblasColMajor, trans, m, n, &alpha, A, lda, x, incx, &beta, y, incy); }
+#undef HOST_GEMV_ARGS
+
+#define HOST_GBMV_ARGS(T) CBLAS_TRANSPOSE trans, host_blas_int m, host_blas_int n, host_blas_int kl, host_blas_int ku, T alpha, const T* A, host_blas_int lda, const T* x, host_blas_int incx, T beta, T* y, host_blas_int incy
+inline void host_gbmv(HOST_GBMV_ARGS(float)) { cblas_sgbmv(CblasColMajor, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_gbmv(HOST_GBMV_ARGS(double)) { cblas_dgbmv(CblasColMajor, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_gbmv(HOST_GBMV_ARGS(host_complex)) { cblas_cgbmv(CblasColMajor, trans, m, n, kl, ku, &alpha, A, lda, x, incx, &beta, y, incy); }
+inline void host_gbmv(HOST_GBMV_ARGS(host_double_complex)) { cblas_zgbmv(CblasColMajor, trans, m, n, kl, ku, &alpha, A, lda, x, incx, &beta, y, incy); }
+#undef HOST_GBMV_ARGS
+
+#define HOST_GER_ARGS(T) host_blas_int m, host_blas_int n, T alpha, const T* x, host_blas_int incx, const T* y, host_blas_int incy, T* A, host_blas_int lda
+inline void host_ger(HOST_GER_ARGS(float)) { cblas_sger(CblasColMajor, m, n, alpha, x, incx, y, incy, A, lda); }
+inline void host_ger(HOST_GER_ARGS(double)) { cblas_dger(CblasColMajor, m, n, alpha, x, incx, y, incy, A, lda); }
+inline void host_ger(HOST_GER_ARGS(host_complex)) { cblas_cgeru(CblasColMajor, m, n, &alpha, x, incx, y, incy, A, lda); }
+inline void host_ger(HOST_GER_ARGS(host_double_complex)) { cblas_zgeru(CblasColMajor, m, n, &alpha, x, incx, y, incy, A, lda); }
+inline void host_gerc(HOST_GER_ARGS(host_complex)) { cblas_cgerc(CblasColMajor, m, n, &alpha, x, incx, y, incy, A, lda); }
+inline void host_gerc(HOST_GER_ARGS(host_double_complex)) { cblas_zgerc(CblasColMajor, m, n, &alpha, x, incx, y, incy, A, lda); }
+#undef HOST_GER_ARGS
+
+#define HOST_SYMV_ARGS(T) CBLAS_UPLO uplo, host_blas_int n, T alpha, const T* A, host_blas_int lda, const T* x, host_blas_int incx, T beta, T* y, host_blas_int incy
+inline void host_symv(HOST_SYMV_ARGS(float)) { cblas_ssymv(CblasColMajor, uplo, n, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_symv(HOST_SYMV_ARGS(double)) { cblas_dsymv(CblasColMajor, uplo, n, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_hemv(HOST_SYMV_ARGS(host_complex)) { cblas_chemv(CblasColMajor, uplo, n, &alpha, A, lda, x, incx, &beta, y, incy); }
+inline void host_hemv(HOST_SYMV_ARGS(host_double_complex)) { cblas_zhemv(CblasColMajor, uplo, n, &alpha, A, lda, x, incx, &beta, y, incy); }
+#undef HOST_SYMV_ARGS
+
+#define HOST_SBMV_ARGS(T) CBLAS_UPLO uplo, host_blas_int n, host_blas_int k, T alpha, const T* A, host_blas_int lda, const T* x, host_blas_int incx, T beta, T* y, host_blas_int incy
+inline void host_sbmv(HOST_SBMV_ARGS(float)) { cblas_ssbmv(CblasColMajor, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_sbmv(HOST_SBMV_ARGS(double)) { cblas_dsbmv(CblasColMajor, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy); }
+inline void host_hbmv(HOST_SBMV_ARGS(host_complex)) { cblas_chbmv(CblasColMajor, uplo, n, k, &alpha, A, lda, x, incx, &beta, y, incy); }
+inline void host_hbmv(HOST_SBMV_ARGS(host_double_complex)) { cblas_zhbmv(CblasColMajor, uplo, n, k, &alpha, A, lda, x, incx, &beta, y, incy); }
+#undef HOST_SBMV_ARGS
+
+#define HOST_SPMV_ARGS(T) CBLAS_UPLO uplo, host_blas_int n, T alpha, const T* AP, const T* x, host_blas_int incx, T beta, T* y, host_blas_int incy
+inline void host_spmv(HOST_SPMV_ARGS(float)) { cblas_sspmv(CblasColMajor, uplo, n, alpha, AP, x, incx, beta, y, incy); }
+inline void host_spmv(HOST_SPMV_ARGS(double)) { cblas_dspmv(CblasColMajor, uplo, n, alpha, AP, x, incx, beta, y, incy); }
+inline void host_hpmv(HOST_SPMV_ARGS(host_complex)) { cblas_chpmv(CblasColMajor, uplo, n, &alpha, AP, x, incx, &beta, y, incy); }
+inline void host_hpmv(HOST_SPMV_ARGS(host_double_complex)) { cblas_zhpmv(CblasColMajor, uplo, n, &alpha, AP, x, incx, &beta, y, incy); }
+#undef HOST_SPMV_ARGS
+
+inline void host_syr(CBLAS_UPLO uplo, host_blas_int n, float alpha, const float* x, host_blas_int incx, float* A, host_blas_int lda) { cblas_ssyr(CblasColMajor, uplo, n, alpha, x, incx, A, lda); }
+inline void host_syr(CBLAS_UPLO uplo, host_blas_int n, double alpha, const double* x, host_blas_int incx, double* A, host_blas_int lda) { cblas_dsyr(CblasColMajor, uplo, n, alpha, x, incx, A, lda); }
+inline void host_her(CBLAS_UPLO uplo, host_blas_int n, float alpha, const host_complex* x, host_blas_int incx, host_complex* A, host_blas_int lda) { cblas_cher(CblasColMajor, uplo, n, alpha, x, incx, A, lda); }
+inline void host_her(CBLAS_UPLO uplo, host_blas_int n, double alpha, const host_double_complex* x, host_blas_int incx, host_double_complex* A, host_blas_int lda) { cblas_zher(CblasColMajor, uplo, n, alpha, x, incx, A, lda); }
+
+inline void host_spr(CBLAS_UPLO uplo, host_blas_int n, float alpha, const float* x, host_blas_int incx, float* AP) { cblas_sspr(CblasColMajor, uplo, n, alpha, x, incx, AP); }
+inline void host_spr(CBLAS_UPLO uplo, host_blas_int n, double alpha, const double* x, host_blas_int incx, double* AP) { cblas_dspr(CblasColMajor, uplo, n, alpha, x, incx, AP); }
+inline void host_hpr(CBLAS_UPLO uplo, host_blas_int n, float alpha, const host_complex* x, host_blas_int incx, host_complex* AP) { cblas_chpr(CblasColMajor, uplo, n, alpha, x, incx, AP); }
+inline void host_hpr(CBLAS_UPLO uplo, host_blas_int n, double alpha, const host_double_complex* x, host_blas_int incx, host_double_complex* AP) { cblas_zhpr(CblasColMajor, uplo, n, alpha, x, incx, AP); }
+
+#define HOST_SYR2_ARGS(T) CBLAS_UPLO uplo, host_blas_int n, T alpha, const T* x, host_blas_int incx, const T* y, host_blas_int incy, T* A, host_blas_int lda
+inline void host_syr2(HOST_SYR2_ARGS(float)) { cblas_ssyr2(CblasColMajor, uplo, n, alpha, x, incx, y, incy, A, lda); }
+inline void host_syr2(HOST_SYR2_ARGS(double)) { cblas_dsyr2(CblasColMajor, uplo, n, alpha, x, incx, y, incy, A, lda); }
+inline void host_her2(HOST_SYR2_ARGS(host_complex)) { cblas_cher2(CblasColMajor, uplo, n, &alpha, x, incx, y, incy, A, lda); }
+inline void host_her2(HOST_SYR2_ARGS(host_double_complex)) { cblas_zher2(CblasColMajor, uplo, n, &alpha, x, incx, y, incy, A, lda); }
+#undef HOST_SYR2_ARGS
+
+#define HOST_SPR2_ARGS(T) CBLAS_UPLO uplo, host_blas_int n, T alpha, const T* x, host_blas_int incx, const T* y, host_blas_int incy, T* AP
+inline void host_spr2(HOST_SPR2_ARGS(float)) { cblas_sspr2(CblasColMajor, uplo, n, alpha, x, incx, y, incy, AP); }
+inline void host_spr2(HOST_SPR2_ARGS(double)) { cblas_dspr2(CblasColMajor, uplo, n, alpha, x, incx, y, incy, AP); }
+inline void host_hpr2(HOST_SPR2_ARGS(host_complex)) { cblas_chpr2(CblasColMajor, uplo, n, &alpha, x, incx, y, incy, AP); }
+inline void host_hpr2(HOST_SPR2_ARGS(host_double_complex)) { cblas_zhpr2(CblasColMajor, uplo, n, &alpha, x, incx, y, incy, AP); }
+#undef HOST_SPR2_ARGS
+
+#define HOST_TRMV_ARGS(T) CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, host_blas_int n, const T* A, host_blas_int lda, T* x, host_blas_int incx
+inline void host_trmv(HOST_TRMV_ARGS(float)) { cblas_strmv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trmv(HOST_TRMV_ARGS(double)) { cblas_dtrmv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trmv(HOST_TRMV_ARGS(host_complex)) { cblas_ctrmv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trmv(HOST_TRMV_ARGS(host_double_complex)) { cblas_ztrmv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trsv(HOST_TRMV_ARGS(float)) { cblas_strsv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trsv(HOST_TRMV_ARGS(double)) { cblas_dtrsv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trsv(HOST_TRMV_ARGS(host_complex)) { cblas_ctrsv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+inline void host_trsv(HOST_TRMV_ARGS(host_double_complex)) { cblas_ztrsv(CblasColMajor, uplo, trans, diag, n, A, lda, x, incx); }
+#undef HOST_TRMV_ARGS
+
+#define HOST_TBMV_ARGS(T) CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, host_blas_int n, host_blas_int k, const T* A, host_blas_int lda, T* x, host_blas_int incx
+inline void host_tbmv(HOST_TBMV_ARGS(float)) { cblas_stbmv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbmv(HOST_TBMV_ARGS(double)) { cblas_dtbmv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbmv(HOST_TBMV_ARGS(host_complex)) { cblas_ctbmv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbmv(HOST_TBMV_ARGS(host_double_complex)) { cblas_ztbmv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbsv(HOST_TBMV_ARGS(float)) { cblas_stbsv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbsv(HOST_TBMV_ARGS(double)) { cblas_dtbsv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbsv(HOST_TBMV_ARGS(host_complex)) { cblas_ctbsv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+inline void host_tbsv(HOST_TBMV_ARGS(host_double_complex)) { cblas_ztbsv(CblasColMajor, uplo, trans, diag, n, k, A, lda, x, incx); }
+#undef HOST_TBMV_ARGS
+
+#define HOST_TPMV_ARGS(T) CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, host_blas_int n, const T* AP, T* x, host_blas_int incx
+inline void host_tpmv(HOST_TPMV_ARGS(float)) { cblas_stpmv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpmv(HOST_TPMV_ARGS(double)) { cblas_dtpmv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpmv(HOST_TPMV_ARGS(host_complex)) { cblas_ctpmv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpmv(HOST_TPMV_ARGS(host_double_complex)) { cblas_ztpmv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpsv(HOST_TPMV_ARGS(float)) { cblas_stpsv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpsv(HOST_TPMV_ARGS(double)) { cblas_dtpsv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpsv(HOST_TPMV_ARGS(host_complex)) { cblas_ctpsv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+inline void host_tpsv(HOST_TPMV_ARGS(host_double_complex)) { cblas_ztpsv(CblasColMajor, uplo, trans, diag, n, AP, x, incx); }
+#undef HOST_TPMV_ARGS
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+
+#define HOST_GEMM_ARGS(T) CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB, host_blas_int m, host_blas_int n, host_blas_int k, T alpha, const T* A, host_blas_int lda, const T* B, host_blas_int ldb, T beta, T* C, host_blas_int ldc
+inline void host_gemm(HOST_GEMM_ARGS(float)) { cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_gemm(HOST_GEMM_ARGS(double)) { cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_gemm(HOST_GEMM_ARGS(host_complex)) { cblas_cgemm(CblasColMajor, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_gemm(HOST_GEMM_ARGS(host_double_complex)) { cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+#undef HOST_GEMM_ARGS
+
+#define HOST_SYMM_ARGS(T) CBLAS_SIDE side, CBLAS_UPLO uplo, host_blas_int m, host_blas_int n, T alpha, const T* A, host_blas_int lda, const T* B, host_blas_int ldb, T beta, T* C, host_blas_int ldc
+inline void host_symm(HOST_SYMM_ARGS(float)) { cblas_ssymm(CblasColMajor, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_symm(HOST_SYMM_ARGS(double)) { cblas_dsymm(CblasColMajor, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_symm(HOST_SYMM_ARGS(host_complex)) { cblas_csymm(CblasColMajor, side, uplo, m, n, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_symm(HOST_SYMM_ARGS(host_double_complex)) { cblas_zsymm(CblasColMajor, side, uplo, m, n, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_hemm(HOST_SYMM_ARGS(host_complex)) { cblas_chemm(CblasColMajor, side, uplo, m, n, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_hemm(HOST_SYMM_ARGS(host_double_complex)) { cblas_zhemm(CblasColMajor, side, uplo, m, n, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+#undef HOST_SYMM_ARGS
+
+#define HOST_SYRK_ARGS(T, S) CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, host_blas_int n, host_blas_int k, S alpha, const T* A, host_blas_int lda, S beta, T* C, host_blas_int ldc
+inline void host_syrk(HOST_SYRK_ARGS(float, float)) { cblas_ssyrk(CblasColMajor, uplo, trans, n, k, alpha, A, lda, beta, C, ldc); }
+inline void host_syrk(HOST_SYRK_ARGS(double, double)) { cblas_dsyrk(CblasColMajor, uplo, trans, n, k, alpha, A, lda, beta, C, ldc); }
+inline void host_syrk(HOST_SYRK_ARGS(host_complex, host_complex)) { cblas_csyrk(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc); }
+inline void host_syrk(HOST_SYRK_ARGS(host_double_complex, host_double_complex)) { cblas_zsyrk(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc); }
+inline void host_herk(HOST_SYRK_ARGS(host_complex, float)) { cblas_cherk(CblasColMajor, uplo, trans, n, k, alpha, A, lda, beta, C, ldc); }
+inline void host_herk(HOST_SYRK_ARGS(host_double_complex, double)) { cblas_zherk(CblasColMajor, uplo, trans, n, k, alpha, A, lda, beta, C, ldc); }
+#undef HOST_SYRK_ARGS
+
+#define HOST_SYR2K_ARGS(T, S) CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, host_blas_int n, host_blas_int k, T alpha, const T* A, host_blas_int lda, const T* B, host_blas_int ldb, S beta, T* C, host_blas_int ldc
+inline void host_syr2k(HOST_SYR2K_ARGS(float, float)) { cblas_ssyr2k(CblasColMajor, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_syr2k(HOST_SYR2K_ARGS(double, double)) { cblas_dsyr2k(CblasColMajor, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_syr2k(HOST_SYR2K_ARGS(host_complex, host_complex)) { cblas_csyr2k(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_syr2k(HOST_SYR2K_ARGS(host_double_complex, host_double_complex)) { cblas_zsyr2k(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc); }
+inline void host_her2k(HOST_SYR2K_ARGS(host_complex, float)) { cblas_cher2k(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, B, ldb, beta, C, ldc); }
+inline void host_her2k(HOST_SYR2K_ARGS(host_double_complex, double)) { cblas_zher2k(CblasColMajor, uplo, trans, n, k, &alpha, A, lda, B, ldb, beta, C, ldc); }
+#undef HOST_SYR2K_ARGS
+
+#define HOST_TRMM_ARGS(T) CBLAS_SIDE side, CBLAS_UPLO uplo, CBLAS_TRANSPOSE transA, CBLAS_DIAG diag, host_blas_int m, host_blas_int n, T alpha, const T* A, host_blas_int lda, T* B, host_blas_int ldb
+inline void host_trmm(HOST_TRMM_ARGS(float)) { cblas_strmm(CblasColMajor, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb); }
+inline void host_trmm(HOST_TRMM_ARGS(double)) { cblas_dtrmm(CblasColMajor, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb); }
+inline void host_trmm(HOST_TRMM_ARGS(host_complex)) { cblas_ctrmm(CblasColMajor, side, uplo, transA, diag, m, n, &alpha, A, lda, B, ldb); }
+inline void host_trmm(HOST_TRMM_ARGS(host_double_complex)) { cblas_ztrmm(CblasColMajor, side, uplo, transA, diag, m, n, &alpha, A, lda, B, ldb); }
+inline void host_trsm(HOST_TRMM_ARGS(float)) { cblas_strsm(CblasColMajor, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb); }
+inline void host_trsm(HOST_TRMM_ARGS(double)) { cblas_dtrsm(CblasColMajor, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb); }
+inline void host_trsm(HOST_TRMM_ARGS(host_complex)) { cblas_ctrsm(CblasColMajor, side, uplo, transA, diag, m, n, &alpha, A, lda, B, ldb); }
+inline void host_trsm(HOST_TRMM_ARGS(host_double_complex)) { cblas_ztrsm(CblasColMajor, side, uplo, transA, diag, m, n, &alpha, A, lda, B, ldb); }
+#undef HOST_TRMM_ARGS
+
+/*
+ * ===========================================================================
+ *    LAPACK
+ * ===========================================================================
+ */
+
+inline void host_getrf(host_blas_int m, host_blas_int n, float* A, host_blas_int lda, host_blas_int* ipiv, host_blas_int* info) { sgetrf_(&m, &n, A, &lda, ipiv, info); }
+inline void host_getrf(host_blas_int m, host_blas_int n, double* A, host_blas_int lda, host_blas_int* ipiv, host_blas_int* info) { dgetrf_(&m, &n, A, &lda, ipiv, info); }
+inline void host_getrf(host_blas_int m, host_blas_int n, host_complex* A, host_blas_int lda, host_blas_int* ipiv, host_blas_int* info) { cgetrf_(&m, &n, A, &lda, ipiv, info); }
+inline void host_getrf(host_blas_int m, host_blas_int n, host_double_complex* A, host_blas_int lda, host_blas_int* ipiv, host_blas_int* info) { zgetrf_(&m, &n, A, &lda, ipiv, info); }
+
+#define HOST_GETRS_ARGS(T) char trans, host_blas_int n, host_blas_int nrhs, T* A, host_blas_int lda, host_blas_int* ipiv, T* B, host_blas_int ldb, host_blas_int* info
+inline void host_getrs(HOST_GETRS_ARGS(float)) { sgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info); }
+inline void host_getrs(HOST_GETRS_ARGS(double)) { dgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info); }
+inline void host_getrs(HOST_GETRS_ARGS(host_complex)) { cgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info); }
+inline void host_getrs(HOST_GETRS_ARGS(host_double_complex)) { zgetrs_(&trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info); }
+#undef HOST_GETRS_ARGS
+
+#define HOST_GETRI_ARGS(T) host_blas_int n, T* A, host_blas_int lda, host_blas_int* ipiv, T* work, host_blas_int lwork, host_blas_int* info
+inline void host_getri(HOST_GETRI_ARGS(float)) { sgetri_(&n, A, &lda, ipiv, work, &lwork, info); }
+inline void host_getri(HOST_GETRI_ARGS(double)) { dgetri_(&n, A, &lda, ipiv, work, &lwork, info); }
+inline void host_getri(HOST_GETRI_ARGS(host_complex)) { cgetri_(&n, A, &lda, ipiv, work, &lwork, info); }
+inline void host_getri(HOST_GETRI_ARGS(host_double_complex)) { zgetri_(&n, A, &lda, ipiv, work, &lwork, info); }
+#undef HOST_GETRI_ARGS
+
+#define HOST_GEQRF_ARGS(T) host_blas_int m, host_blas_int n, T* A, host_blas_int lda, T* tau, T* work, host_blas_int lwork, host_blas_int* info
+inline void host_geqrf(HOST_GEQRF_ARGS(float)) { sgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info); }
+inline void host_geqrf(HOST_GEQRF_ARGS(double)) { dgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info); }
+inline void host_geqrf(HOST_GEQRF_ARGS(host_complex)) { cgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info); }
+inline void host_geqrf(HOST_GEQRF_ARGS(host_double_complex)) { zgeqrf_(&m, &n, A, &lda, tau, work, &lwork, info); }
+#undef HOST_GEQRF_ARGS
+
+#define HOST_GELS_ARGS(T) char trans, host_blas_int m, host_blas_int n, host_blas_int nrhs, T* A, host_blas_int lda, T* B, host_blas_int ldb, T* work, host_blas_int lwork, host_blas_int* info
+inline void host_gels(HOST_GELS_ARGS(float)) { sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info); }
+inline void host_gels(HOST_GELS_ARGS(double)) { dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info); }
+inline void host_gels(HOST_GELS_ARGS(host_complex)) { cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info); }
+inline void host_gels(HOST_GELS_ARGS(host_double_complex)) { zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info); }
+#undef HOST_GELS_ARGS
+
+inline void host_trtri(char uplo, char diag, host_blas_int n, float* A, host_blas_int lda, host_blas_int* info) { strtri_(&uplo, &diag, &n, A, &lda, info); }
+inline void host_trtri(char uplo, char diag, host_blas_int n, double* A, host_blas_int lda, host_blas_int* info) { dtrtri_(&uplo, &diag, &n, A, &lda, info); }
+inline void host_trtri(char uplo, char diag, host_blas_int n, host_complex* A, host_blas_int lda, host_blas_int* info) { ctrtri_(&uplo, &diag, &n, A, &lda, info); }
+inline void host_trtri(char uplo, char diag, host_blas_int n, host_double_complex* A, host_blas_int lda, host_blas_int* info) { ztrtri_(&uplo, &diag, &n, A, &lda, info); }
+// clang-format on
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "host_thread_pool.hpp"
+#include <cstdlib>
+
+hipblas_host_thread_pool& hipblas_host_thread_pool::instance()
+{
+    static hipblas_host_thread_pool pool;
+    return pool;
+}
+
+hipblas_host_thread_pool::hipblas_host_thread_pool()
+{
+    size_t num_threads = std::thread::hardware_concurrency();
+
+    const char* env = std::getenv("HIPBLAS_HOST_NUM_THREADS");
+    if(env)
+    {
+        long requested = std::strtol(env, nullptr, 10);
+        if(requested > 0)
+            num_threads = size_t(requested);
+    }
+
+    // the calling thread is one of the workers
+    for(size_t i = 1; i < num_threads; i++)
+        m_workers.emplace_back(&hipblas_host_thread_pool::worker_loop, this);
+}
+
+hipblas_host_thread_pool::~hipblas_host_thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for(auto& worker : m_workers)
+        worker.join();
+}
+
+void hipblas_host_thread_pool::drain(invoke_t invoke, void* ctx, int64_t count)
+{
+    for(int64_t i = m_next.fetch_add(1); i < count; i = m_next.fetch_add(1))
+        invoke(ctx, i);
+}
+
+void hipblas_host_thread_pool::run(int64_t count, invoke_t invoke, void* ctx)
+{
+    std::unique_lock<std::mutex> submit(m_submit_mutex, std::try_to_lock);
+    if(!submit.owns_lock() || m_workers.empty())
+    {
+        for(int64_t i = 0; i < count; i++)
+            invoke(ctx, i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_invoke = invoke;
+        m_ctx    = ctx;
+        m_count  = count;
+        m_next.store(0);
+        m_active = m_workers.size();
+        m_generation++;
+    }
+    m_start.notify_all();
+
+    drain(invoke, ctx, count);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_active == 0; });
+}
+
+void hipblas_host_thread_pool::worker_loop()
+{
+    uint64_t seen = 0;
+    for(;;)
+    {
+        invoke_t invoke;
+        void*    ctx;
+        int64_t  count;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if(m_stop)
+                return;
+            seen   = m_generation;
+            invoke = m_invoke;
+            ctx    = m_ctx;
+            count  = m_count;
+        }
+
+        drain(invoke, ctx, count);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(--m_active == 0)
+            m_done.notify_one();
+    }
+}
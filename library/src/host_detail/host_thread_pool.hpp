@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*! \brief Persistent pool of host threads used to spread the instances of batched and
+ *         strided-batched calls on the host backend.
+ *
+ *  The calling thread always takes part in the work. Only one parallel region runs at a time;
+ *  a thread that finds the pool busy runs its batch inline instead of waiting, so concurrent
+ *  callers never serialize behind each other. The worker count defaults to the hardware
+ *  concurrency and can be overridden with the HIPBLAS_HOST_NUM_THREADS environment variable.
+ */
+class hipblas_host_thread_pool
+{
+public:
+    static hipblas_host_thread_pool& instance();
+
+    // Call func(i) for every i in [0, count)
+    template <typename F>
+    void parallel_for(int64_t count, F&& func)
+    {
+        using func_t = typename std::remove_reference<F>::type;
+        run(
+            count,
+            [](void* ctx, int64_t i) { (*static_cast<func_t*>(ctx))(i); },
+            const_cast<void*>(static_cast<const void*>(&func)));
+    }
+
+    size_t num_threads() const
+    {
+        return m_workers.size() + 1;
+    }
+
+private:
+    using invoke_t = void (*)(void*, int64_t);
+
+    hipblas_host_thread_pool();
+    ~hipblas_host_thread_pool();
+
+    hipblas_host_thread_pool(const hipblas_host_thread_pool&) = delete;
+    hipblas_host_thread_pool& operator=(const hipblas_host_thread_pool&) = delete;
+
+    void run(int64_t count, invoke_t invoke, void* ctx);
+    void drain(invoke_t invoke, void* ctx, int64_t count);
+    void worker_loop();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex              m_submit_mutex;
+    std::mutex              m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_done;
+
+    invoke_t             m_invoke     = nullptr;
+    void*                m_ctx        = nullptr;
+    int64_t              m_count      = 0;
+    uint64_t             m_generation = 0;
+    size_t               m_active     = 0;
+    bool                 m_stop       = false;
+    std::atomic<int64_t> m_next{0};
+};
+
+template <typename F>
+inline void hipblas_host_parallel_for(int64_t count, F&& func)
+{
+    if(count == 1)
+        func(int64_t(0));
+    else if(count > 1)
+        hipblas_host_thread_pool::instance().parallel_for(count, func);
+}
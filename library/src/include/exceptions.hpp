@@ -27,7 +27,8 @@
 
 // Convert the current C++ exception to hiblasStatus_t
 // This allows extern "C" functions to return this function in a catch(...) block
-// while converting all C++ exceptions to an equivalent hipblasStatus_t here
+// while converting all C++ exceptions to an equivalent hipblasStatus_t here.
+// Only runs once a call has failed; calls that succeed never throw or rethrow.
 inline hipblasStatus_t hipblas_exception_to_status(std::exception_ptr e = std::current_exception())
 try
 {
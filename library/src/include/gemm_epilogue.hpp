@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <hip/library_types.h>
+
+/*! \brief Device memory holding the values 1 and 0 of type, one after the other, for the alpha
+ *         and beta of GEMMs hipBLAS queues itself on a handle in device pointer mode.
+ *
+ *  type is HIP_R_16F, HIP_R_32F, HIP_R_64F or HIP_R_32I. Returns nullptr for any other type, or
+ *  if the address on the current device cannot be found.
+ */
+const void* hipblasDeviceOneZero(hipDataType type);
+
+/*! \brief Queue the requantization of the int32 product of an int8 GEMM on stream.
+ *
+ *  Element (i, j) of the m by n matrix acc is multiplied in float by row_scale[i]*col_scale[j]
+ *  and stored in c, of type HIP_R_16F or HIP_R_8I. An int8 result is rounded to the nearest
+ *  integer, ties to even, offset by zero_point and saturated. A null row_scale or col_scale
+ *  counts as a vector of ones.
+ */
+hipError_t hipblasLaunchRequantize(hipStream_t    stream,
+                                   int64_t        m,
+                                   int64_t        n,
+                                   const int32_t* acc,
+                                   int64_t        ld_acc,
+                                   const float*   row_scale,
+                                   const float*   col_scale,
+                                   int32_t        zero_point,
+                                   void*          c,
+                                   hipDataType    c_type,
+                                   int64_t        ldc);
+
+/*! \brief Activations of hipblasLaunchGemmEpilogue, numbered as hipblasGemmActivation_t, which
+ *         the device code does not see.
+ */
+enum hipblasEpilogueActivation : int32_t
+{
+    hipblas_epilogue_activation_none = 0,
+    hipblas_epilogue_activation_relu = 1,
+    hipblas_epilogue_activation_gelu = 2,
+};
+
+/*! \brief Queue the epilogue set with hipblasSetGemmEpilogue for batch_count m by n matrices d
+ *         of type d_type on stream, after the GEMM writing them.
+ *
+ *  Element (i, j) of instance b becomes act(d + bias[i]) + aux[i + j*ld_aux], with bias and
+ *  aux offset by b*stride_bias and b*stride_aux. A null bias or aux is not added. d_type is
+ *  HIP_R_16F, HIP_R_16BF, HIP_R_32F or HIP_R_64F; the sum is evaluated in float, or in double
+ *  for HIP_R_64F, and rounded to d_type once.
+ */
+hipError_t hipblasLaunchGemmEpilogue(hipStream_t               stream,
+                                     int64_t                   m,
+                                     int64_t                   n,
+                                     int64_t                   batch_count,
+                                     hipblasEpilogueActivation activation,
+                                     const void*               bias,
+                                     int64_t                   stride_bias,
+                                     const void*               aux,
+                                     int64_t                   ld_aux,
+                                     int64_t                   stride_aux,
+                                     void*                     d,
+                                     hipDataType               d_type,
+                                     int64_t                   ldd,
+                                     int64_t                   stride_d);
+
+/*! \brief Queue the filling of the device array of count pointers array with base + b*stride
+ *         bytes on stream, so that packed matrices can be passed to a batched GEMM.
+ */
+hipError_t hipblasLaunchPointerArray(
+    hipStream_t stream, void* base, size_t stride, int64_t count, void** array);
+
+/*! \brief Queue the scaling of batch_count products of a GEMM into m by n matrices c of type
+ *         c_type on stream, with an alpha and a beta per instance.
+ *
+ *  Element (i, j) of instance b becomes alpha_b*product[i + j*m] + beta_b*c[i + j*ldc], with
+ *  alpha_b = alpha[b*stride_alpha], beta_b = beta[b*stride_beta] and the products packed one
+ *  after the other. c is not read where beta_b is 0. Instance b of c is c_array[b] when c_array
+ *  is non-null, else c + b*stride_c. scalar_type is HIP_R_16F or HIP_R_32F for a c_type of
+ *  HIP_R_16F, HIP_R_32F for HIP_R_16BF and HIP_R_32F, and HIP_R_64F for HIP_R_64F. The products
+ *  are of scalar_type too, so that a 16-bit c with float scalars is rounded once, and cannot
+ *  overflow where alpha brings the result back in range; the sum is evaluated as in
+ *  hipblasLaunchGemmEpilogue.
+ */
+hipError_t hipblasLaunchScalarStride(hipStream_t  stream,
+                                     int64_t      m,
+                                     int64_t      n,
+                                     int64_t      batch_count,
+                                     const void*  alpha,
+                                     int64_t      stride_alpha,
+                                     const void*  beta,
+                                     int64_t      stride_beta,
+                                     hipDataType  scalar_type,
+                                     const void*  product,
+                                     void*        c,
+                                     void* const* c_array,
+                                     hipDataType  c_type,
+                                     int64_t      ldc,
+                                     int64_t      stride_c);
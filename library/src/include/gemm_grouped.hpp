@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <cstdint>
+
+/*! \brief Issue the groups of a grouped batched GEMM one after the other on handle.
+ *
+ *  group(g, first) runs group g as one batched GEMM over the group_size[g] instances that start
+ *  at index first of the pointer arrays. host_arrays are the per-group arrays read on the host,
+ *  which must be non-null when there is a group. Empty groups are skipped. Stops at, and
+ *  returns, the first error.
+ */
+template <typename I, typename F, typename... Arrays>
+hipblasStatus_t hipblas_gemm_grouped_execute(hipblasHandle_t handle,
+                                             I               group_count,
+                                             const I         group_size[],
+                                             F&&             group,
+                                             const Arrays*... host_arrays)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(group_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(group_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!group_size || (!host_arrays || ...))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(I g = 0; g < group_count; g++)
+        if(group_size[g] < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int64_t first = 0;
+    for(I g = 0; g < group_count; g++)
+    {
+        if(!group_size[g])
+            continue;
+
+        hipblasStatus_t status = group(g, first);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        first += group_size[g];
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Entry first of an array of pointers or of typed scalars; nullptr stays nullptr so that the
+// batched routine still reports it
+template <typename T>
+T* hipblas_grouped_offset(T* array, int64_t first)
+{
+    return array ? array + first : array;
+}
+
+inline const void* hipblas_grouped_offset(const void* array, int64_t first, size_t size)
+{
+    return array ? static_cast<const char*>(array) + first * size : array;
+}
+
+// Size of the alpha and beta scalars of a GEMM Ex call
+inline size_t hipblas_gemm_ex_scalar_size(hipblasComputeType_t compute_type, hipDataType c_type)
+{
+    size_t size = 4;
+    if(compute_type == HIPBLAS_COMPUTE_16F || compute_type == HIPBLAS_COMPUTE_16F_PEDANTIC)
+        size = 2;
+    else if(compute_type == HIPBLAS_COMPUTE_64F || compute_type == HIPBLAS_COMPUTE_64F_PEDANTIC)
+        size = 8;
+    return c_type == HIP_C_16F || c_type == HIP_C_32F || c_type == HIP_C_64F ? 2 * size : size;
+}
+
+inline size_t hipblas_gemm_ex_scalar_size(hipblasDatatype_t compute_type)
+{
+    switch(compute_type)
+    {
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+        return 2;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 4;
+    }
+}
+
+/*! \brief GEMM handed to hipblasGemmScalarStrideDevice. product(context, d, d_type, ldd, one,
+ *  zero) queues the products op(A_i)*op(B_i) of the whole batch into d of type d_type with
+ *  leading dimension ldd, passing one and zero as alpha and beta in device pointer mode. d_type
+ *  is the type of C, or HIP_R_32F for a 16-bit C with float scalars. d is a device array of
+ *  pointers for a batched C, else the strided matrices, packed. context is the product_context
+ *  given to hipblasGemmScalarStrideDevice.
+ */
+using hipblasScalarStrideProduct = hipblasStatus_t (*)(void*       context,
+                                                       void*       d,
+                                                       hipDataType d_type,
+                                                       int64_t     ldd,
+                                                       const void* one,
+                                                       const void* zero);
+
+/*! \brief Queue a batched GEMM with device scalars advancing by stride_alpha and stride_beta per
+ *  instance as product and a scaling pass over the m by n matrices C of type c_type, as stored
+ *  in column-major order.
+ *
+ *  Instance i of C is the i-th pointer of the device array c when c_batched, else c advanced by
+ *  i*stride_c elements. scalar_size is the size of one alpha or beta. Defined by each backend;
+ *  returns HIPBLAS_STATUS_NOT_SUPPORTED, having left C untouched, where the backend does not take
+ *  the call, so the caller issues the instances one at a time.
+ */
+hipblasStatus_t hipblasGemmScalarStrideDevice(hipblasHandle_t            handle,
+                                              int64_t                    m,
+                                              int64_t                    n,
+                                              int64_t                    batch_count,
+                                              const void*                alpha,
+                                              hipblasStride              stride_alpha,
+                                              const void*                beta,
+                                              hipblasStride              stride_beta,
+                                              size_t                     scalar_size,
+                                              hipDataType                c_type,
+                                              void*                      c,
+                                              bool                       c_batched,
+                                              int64_t                    ldc,
+                                              hipblasStride              stride_c,
+                                              hipblasScalarStrideProduct product,
+                                              void*                      product_context);
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+/*! \brief Base of backend specific data kept with a handle, such as auxiliary streams. */
+struct hipblasBackendState
+{
+    virtual ~hipblasBackendState() = default;
+};
+
+/*! \brief Counters of one routine and precision, see hipblasGetHandleStats. */
+struct hipblasRoutineCounters
+{
+    uint64_t calls   = 0;
+    uint64_t host_ns = 0;
+    double   gflops  = 0;
+    double   gbytes  = 0;
+};
+
+/*! \brief Routine, precision and estimated cost of one call, filled in by
+ *  hipblasHandleStatsCount. function and precision have static storage.
+ */
+struct hipblasCallStats
+{
+    const char* function  = nullptr;
+    const char* precision = nullptr;
+    double      gflops    = 0;
+    double      gbytes    = 0;
+};
+
+// Orders the routine and precision keys of the stats by their text
+struct hipblasRoutineKeyLess
+{
+    bool operator()(const std::pair<const char*, const char*>& a,
+                    const std::pair<const char*, const char*>& b) const
+    {
+        int order = strcmp(a.first, b.first);
+        return order ? order < 0 : strcmp(a.second, b.second) < 0;
+    }
+};
+
+struct hipblas_log_value;
+
+/*! \brief Library state attached to a hipblasHandle_t.
+ *
+ *  A hipblasHandle_t is the backend handle itself, so anything hipBLAS needs to remember per
+ *  handle lives in this side table instead. The state is created on first use and released by
+ *  hipblasDestroy. Members are guarded by mutex unless noted otherwise.
+ */
+struct hipblasHandleState
+{
+    std::mutex mutex;
+
+    // Device memory required by a routine for a given shape and type, keyed by
+    // hipblasWorkspaceKey; filled in by hipblasDemandAlloc
+    std::unordered_map<uint64_t, size_t> workspace_sizes;
+
+    // Keys of hipblasDemandAlloc calls which last ran with the workspace the handle holds,
+    // direct mapped on the key, so repeated calls skip mutex and the size lookup. A stale
+    // slot only costs a failed call; cleared when the workspace is replaced. Not guarded
+    // by mutex.
+    static constexpr size_t workspace_fits_slots = 64;
+    std::atomic<uint64_t>   workspace_fits[workspace_fits_slots]{};
+
+    // Set by hipblasSetGraphCaptureMode; not guarded by mutex
+    std::atomic<hipblasGraphCaptureMode_t> graph_capture_mode{HIPBLAS_GRAPH_CAPTURE_DEFAULT};
+
+    // Set by hipblasSetOrder; not guarded by mutex
+    std::atomic<hipblasOrder_t> order{HIPBLAS_ORDER_COLUMN_MAJOR};
+
+    // Pool the handle is checked out of, set by hipblasHandlePoolAcquire and cleared by
+    // hipblasHandlePoolRelease; not guarded by mutex
+    std::atomic<hipblasHandlePool_t> pool{nullptr};
+
+    // Scale factors of 8-bit float GemmEx inputs, set by hipblasSetGemmExScales; not guarded
+    // by mutex
+    std::atomic<float> gemm_ex_scale_a{1.0f};
+    std::atomic<float> gemm_ex_scale_b{1.0f};
+
+    // Set by hipblasSetGemmEpilogue. gemm_epilogue_active is not guarded by mutex, so GemmEx
+    // calls without an epilogue only read the flag.
+    hipblasGemmEpilogue_t gemm_epilogue{};
+    std::atomic<bool>     gemm_epilogue_active{false};
+
+    // Created by the backend the first time it is needed
+    std::unique_ptr<hipblasBackendState> backend;
+
+    // Filled in by the stats layer, keyed by routine and precision
+    std::map<std::pair<const char*, const char*>, hipblasRoutineCounters, hipblasRoutineKeyLess>
+        routine_stats;
+
+    // Times hipBLAS grew the device memory of the handle; not guarded by mutex
+    std::atomic<uint64_t> workspace_reallocations{0};
+};
+
+// Returns the state of handle, creating it if needed. Never returns nullptr.
+hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle);
+
+// Drops the state of handle; called from hipblasDestroy
+void hipblasReleaseHandleState(hipblasHandle_t handle);
+
+// Copies the epilogue set on handle with hipblasSetGemmEpilogue to epilogue, or returns false
+// if there is none
+bool hipblasGetActiveGemmEpilogue(hipblasHandle_t handle, hipblasGemmEpilogue_t& epilogue);
+
+// Checks that epilogue applies to a GemmEx with an m by n C of type c_type
+hipblasStatus_t hipblasCheckGemmEpilogue(const hipblasGemmEpilogue_t& epilogue,
+                                         hipDataType                  c_type,
+                                         int64_t                      m);
+
+// True on a thread while it runs a call remapped from row-major order, see hipblasRowMajorScope
+extern thread_local bool hipblas_row_major_call;
+
+// Adds the flops and bytes of a call logged with format and the count arguments in values to
+// stats. Called once per logged command line, so a grouped call adds up all of its groups and
+// is named by the first one.
+void hipblasHandleStatsCount(hipblasCallStats&       stats,
+                             const char*             format,
+                             const hipblas_log_value values[],
+                             size_t                  count);
+
+// Adds a call of host_ns nanoseconds on handle, counted by hipblasHandleStatsCount, to its stats
+void hipblasHandleStatsAdd(hipblasHandle_t handle, const hipblasCallStats& stats, uint64_t host_ns);
+
+// FNV-1a style key over a routine and the integral and enum arguments it is called with.
+// Pointers and floating-point scalars do not contribute, so the key captures the routine,
+// its type (through the routine) and the problem shape.
+template <typename T>
+inline void hipblasHashArg(uint64_t& key, const T& arg)
+{
+    if constexpr(std::is_integral<T>{} || std::is_enum<T>{})
+        key = (key ^ uint64_t(arg)) * 0x100000001b3ull;
+}
+
+template <typename F, typename... Args>
+inline uint64_t hipblasWorkspaceKey(F func, const Args&... args)
+{
+    uint64_t key = (0xcbf29ce484222325ull ^ uint64_t(reinterpret_cast<uintptr_t>(func)))
+                   * 0x100000001b3ull;
+    (hipblasHashArg(key, args), ...);
+    return key;
+}
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+/*! \brief Bits of HIPBLAS_LAYER; the values match those of ROCBLAS_LAYER. */
+enum hipblas_layer_mode_t : uint32_t
+{
+    hipblas_layer_mode_none        = 0x0,
+    hipblas_layer_mode_log_bench   = 0x2,
+    hipblas_layer_mode_log_profile = 0x4,
+    hipblas_layer_mode_log_record  = 0x8,
+    hipblas_layer_mode_log_trace   = 0x10,
+    hipblas_layer_mode_stats       = 0x20,
+};
+
+// Layers that time the outermost call of a thread
+constexpr uint32_t hipblas_layer_mode_spans
+    = hipblas_layer_mode_log_trace | hipblas_layer_mode_stats;
+
+// Layers that need the hipblas-bench command line of a call
+constexpr uint32_t hipblas_layer_mode_lines
+    = hipblas_layer_mode_log_bench | hipblas_layer_mode_log_profile | hipblas_layer_mode_log_record
+      | hipblas_layer_mode_log_trace;
+
+// Read from HIPBLAS_LAYER when the library is loaded. HIPBLAS_LAYER is either a number or a
+// list of mode names such as "bench", "profile", "record", "trace" or "stats", separated by
+// commas.
+extern uint32_t hipblas_layer_mode;
+
+/*! \brief A host or device pointer to an alpha or beta scalar and the type it points to.
+ *
+ *  Logged as --alpha and --alphai (or --beta and --betai) when the handle is in host pointer
+ *  mode; device scalars cannot be read without synchronizing, so they are left out.
+ */
+struct hipblas_log_scalar
+{
+    const char* name;
+    const void* value;
+    hipDataType type;
+
+    hipblas_log_scalar(const char* name, const void* value, hipDataType type)
+        : name(name)
+        , value(value)
+        , type(type)
+    {
+    }
+
+#ifndef HIPBLAS_V2
+    hipblas_log_scalar(const char* name, const void* value, hipblasDatatype_t type);
+#endif
+
+    // Scalars of the _v2 GEMM Ex functions, which follow the compute type and the type of C
+    hipblas_log_scalar(const char*          name,
+                       const void*          value,
+                       hipblasComputeType_t compute_type,
+                       hipDataType          c_type);
+};
+
+// Text of an argument in a hipblas-bench command line
+std::string hipblas_log_string(hipblasOperation_t op, bool host_scalars);
+std::string hipblas_log_string(hipblasFillMode_t fill, bool host_scalars);
+std::string hipblas_log_string(hipblasDiagType_t diag, bool host_scalars);
+std::string hipblas_log_string(hipblasSideMode_t side, bool host_scalars);
+std::string hipblas_log_string(hipDataType type, bool host_scalars);
+#ifndef HIPBLAS_V2
+std::string hipblas_log_string(hipblasDatatype_t type, bool host_scalars);
+#endif
+std::string hipblas_log_string(hipblasComputeType_t type, bool host_scalars);
+std::string hipblas_log_string(hipblasGemmAlgo_t algo, bool host_scalars);
+std::string hipblas_log_string(hipblasGemmFlags_t flags, bool host_scalars);
+std::string hipblas_log_string(const hipblas_log_scalar& scalar, bool host_scalars);
+std::string hipblas_log_string(const char* text, bool host_scalars);
+
+template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+std::string hipblas_log_string(T value, bool)
+{
+    return std::to_string(value);
+}
+
+/*! \brief An argument of a logged call as the stats layer reads it.
+ *
+ *  Sizes are kept as numbers; operations, sides, types and routine names by their
+ *  hipblas-bench text, which has static storage. Arguments the flop and byte counts do not
+ *  depend on, such as scalars, are left empty, so the stats layer never formats a command line.
+ */
+struct hipblas_log_value
+{
+    int64_t     number = 0;
+    const char* text   = nullptr;
+};
+
+hipblas_log_value hipblas_log_stats_value(hipblasOperation_t op);
+hipblas_log_value hipblas_log_stats_value(hipblasSideMode_t side);
+hipblas_log_value hipblas_log_stats_value(hipDataType type);
+#ifndef HIPBLAS_V2
+hipblas_log_value hipblas_log_stats_value(hipblasDatatype_t type);
+#endif
+hipblas_log_value hipblas_log_stats_value(const char* text);
+
+template <typename T>
+hipblas_log_value hipblas_log_stats_value(const T& value)
+{
+    if constexpr(std::is_integral<T>{})
+        return {int64_t(value), nullptr};
+    else
+        return {};
+}
+
+// True when the scalars of handle are on the host and can be logged
+bool hipblas_log_host_scalars(hipblasHandle_t handle);
+
+// Replaces each {} of format with the next of args and passes the resulting command line for a
+// call made on handle to the enabled layers
+void hipblas_log_call(hipblasHandle_t   handle,
+                      const char*       format,
+                      const std::string args[],
+                      size_t            count);
+
+// Adds the flops and bytes of a call made on handle, with the arguments of the {} of format, to
+// the span of the current thread for the stats layer
+void hipblas_log_stats(hipblasHandle_t         handle,
+                       const char*             format,
+                       const hipblas_log_value values[],
+                       size_t                  count);
+
+// Start and end the span of the outermost hipBLAS call of the current thread, which the trace
+// layer writes out and the stats layer adds to the stats of the handle
+void hipblas_log_span_begin();
+void hipblas_log_span_end();
+
+// Number of hipBLAS calls the current thread is inside of; only calls at depth 0 are logged
+extern thread_local int hipblas_log_depth;
+
+/*! \brief Logs one hipBLAS API call.
+ *
+ *  Declared first in the body of every logged function. The logging itself is behind a check
+ *  of hipblas_layer_mode at the call site, so disabled layers cost that one branch; the
+ *  destructor only does work when something was logged. Calls that hipBLAS makes to itself,
+ *  for example while emulating a batched routine, happen inside the scope of the outer call
+ *  and are not logged again.
+ */
+class hipblas_log_scope
+{
+    bool m_active    = false;
+    bool m_outermost = false;
+
+    bool enter()
+    {
+        if(!m_active)
+        {
+            m_active    = true;
+            m_outermost = hipblas_log_depth++ == 0;
+            if(m_outermost && (hipblas_layer_mode & hipblas_layer_mode_spans))
+                hipblas_log_span_begin();
+        }
+        return m_outermost;
+    }
+
+public:
+    hipblas_log_scope() = default;
+
+    hipblas_log_scope(const hipblas_log_scope&) = delete;
+    hipblas_log_scope& operator=(const hipblas_log_scope&) = delete;
+
+    ~hipblas_log_scope()
+    {
+        if(!m_active)
+            return;
+        if(m_outermost && (hipblas_layer_mode & hipblas_layer_mode_spans))
+            hipblas_log_span_end();
+        hipblas_log_depth--;
+    }
+
+    /*! \brief Logs the call as the hipblas-bench command line that reproduces it.
+     *
+     *  format is the command line with a {} in place of each argument. The bench layer writes
+     *  the line out, the profile layer counts it, the record layer adds it to the trace, and the
+     *  trace layer attaches it to the span of the call, which ends with the scope. The stats
+     *  layer reads the sizes straight from args and adds the flops and bytes to the span. May be
+     *  called more than once per scope, for example once for each group of a grouped GEMM.
+     */
+    template <typename... Ts>
+    void bench(hipblasHandle_t handle, const char* format, const Ts&... args)
+    {
+        if(!enter())
+            return;
+
+        if(hipblas_layer_mode & hipblas_layer_mode_lines)
+        {
+            [[maybe_unused]] bool host_scalars = hipblas_log_host_scalars(handle);
+
+            std::string strings[sizeof...(Ts) + 1] = {hipblas_log_string(args, host_scalars)...};
+            hipblas_log_call(handle, format, strings, sizeof...(Ts));
+        }
+        if(hipblas_layer_mode & hipblas_layer_mode_stats)
+        {
+            hipblas_log_value values[sizeof...(Ts) + 1] = {hipblas_log_stats_value(args)...};
+            hipblas_log_stats(handle, format, values, sizeof...(Ts));
+        }
+    }
+};
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle_state.hpp"
+#include <tuple>
+#include <type_traits>
+
+/*! \brief Marks a call made on a handle in HIPBLAS_ORDER_ROW_MAJOR order, see hipblasSetOrder().
+ *
+ *  A row-major matrix is the transpose of the column-major matrix in the same memory, so a call
+ *  on row-major operands runs as the column-major call computing the transpose of its result.
+ *  Declared first in the body of each function taking a matrix; converts to true when the
+ *  arguments must be remapped with the hipblasRowMajor functions below, which throw
+ *  HIPBLAS_STATUS_NOT_SUPPORTED for calls without a remapping. Calls hipBLAS makes to itself
+ *  while running a remapped call, for example to emulate a batched function, already take the
+ *  remapped arguments and are not remapped again.
+ */
+class hipblasRowMajorScope
+{
+    bool m_active = false;
+
+public:
+    explicit hipblasRowMajorScope(hipblasHandle_t handle)
+    {
+        if(!hipblas_row_major_call && handle
+           && hipblasGetHandleState(handle)->order.load(std::memory_order_relaxed)
+                  == HIPBLAS_ORDER_ROW_MAJOR)
+            m_active = hipblas_row_major_call = true;
+    }
+
+    ~hipblasRowMajorScope()
+    {
+        if(m_active)
+            hipblas_row_major_call = false;
+    }
+
+    hipblasRowMajorScope(const hipblasRowMajorScope&) = delete;
+    hipblasRowMajorScope& operator=(const hipblasRowMajorScope&) = delete;
+
+    explicit operator bool() const
+    {
+        return m_active;
+    }
+};
+
+// Element type of a matrix argument, which is a pointer or, for batched functions, an array of
+// pointers
+template <typename T>
+struct hipblasRowMajorElement
+{
+    using type = std::remove_cv_t<T>;
+};
+
+template <typename T>
+struct hipblasRowMajorElement<T*> : hipblasRowMajorElement<std::remove_cv_t<T>>
+{
+};
+
+template <typename T>
+constexpr bool hipblasRowMajorComplex
+    = std::is_same<typename hipblasRowMajorElement<T>::type, hipblasComplex>{}
+      || std::is_same<typename hipblasRowMajorElement<T>::type, hipblasDoubleComplex>{}
+      || std::is_same<typename hipblasRowMajorElement<T>::type, hipComplex>{}
+      || std::is_same<typename hipblasRowMajorElement<T>::type, hipDoubleComplex>{};
+
+/*! \brief Swaps each argument describing one operand with its counterpart of the other, e.g.
+ *         hipblasRowMajorSwap(std::tie(transA, m, A, lda), std::tie(transB, n, B, ldb)) for
+ *         C = op(A) op(B), which is C^T = op(B^T) op(A^T) in column-major order.
+ */
+template <typename... Ts>
+inline void hipblasRowMajorSwap(std::tuple<Ts&...> a, std::tuple<Ts&...> b)
+{
+    a.swap(b);
+}
+
+// The triangle of A^T holding the uplo triangle of A
+inline void hipblasRowMajorFlip(hipblasFillMode_t& uplo)
+{
+    if(uplo == HIPBLAS_FILL_MODE_UPPER)
+        uplo = HIPBLAS_FILL_MODE_LOWER;
+    else if(uplo == HIPBLAS_FILL_MODE_LOWER)
+        uplo = HIPBLAS_FILL_MODE_UPPER;
+}
+
+// The side of the transposed product on which the matrix applied from side ends up
+inline void hipblasRowMajorFlip(hipblasSideMode_t& side)
+{
+    if(side == HIPBLAS_SIDE_LEFT)
+        side = HIPBLAS_SIDE_RIGHT;
+    else if(side == HIPBLAS_SIDE_RIGHT)
+        side = HIPBLAS_SIDE_LEFT;
+}
+
+/*! \brief The operation on A^T equal to trans on A, for a matrix applied to a vector or forming
+ *         A A^T. A complex A^H is conj(A^T), which has no operation, so it throws.
+ */
+template <typename T>
+inline void hipblasRowMajorTranspose(hipblasOperation_t& trans, const T&)
+{
+    if(trans == HIPBLAS_OP_N)
+        trans = HIPBLAS_OP_T;
+    else if(trans == HIPBLAS_OP_T || (trans == HIPBLAS_OP_C && !hipblasRowMajorComplex<T>))
+        trans = HIPBLAS_OP_N;
+    else if(trans == HIPBLAS_OP_C)
+        throw HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// The operation on A^T for the Hermitian products A A^H, where the result is conjugated too
+inline void hipblasRowMajorConjTranspose(hipblasOperation_t& trans)
+{
+    if(trans == HIPBLAS_OP_N)
+        trans = HIPBLAS_OP_C;
+    else if(trans == HIPBLAS_OP_C)
+        trans = HIPBLAS_OP_N;
+}
+
+// gemv and trmv type functions: y = op(A) x is y = op'(A^T) x with the dimensions of A swapped
+template <typename I, typename T>
+inline void hipblasRowMajorGemv(hipblasOperation_t& trans, I& m, I& n, const T& A)
+{
+    hipblasRowMajorTranspose(trans, A);
+    hipblasRowMajorSwap(std::tie(m), std::tie(n));
+}
+
+// symm, trmm and trsm type functions: C = A B is C^T = B^T A^T, with A on the other side
+template <typename I>
+inline void hipblasRowMajorSide(hipblasSideMode_t& side, hipblasFillMode_t& uplo, I& m, I& n)
+{
+    hipblasRowMajorFlip(side);
+    hipblasRowMajorFlip(uplo);
+    hipblasRowMajorSwap(std::tie(m), std::tie(n));
+}
+
+// dgmm: C = A diag(x) is C^T = diag(x) A^T
+template <typename I>
+inline void hipblasRowMajorSide(hipblasSideMode_t& side, I& m, I& n)
+{
+    hipblasRowMajorFlip(side);
+    hipblasRowMajorSwap(std::tie(m), std::tie(n));
+}
+
+// syrk type functions: C = op(A) op(A)^T is symmetric, so only its triangle and the operation on
+// A^T change
+template <typename T>
+inline void hipblasRowMajorSyrk(hipblasFillMode_t& uplo, hipblasOperation_t& trans, const T& A)
+{
+    hipblasRowMajorFlip(uplo);
+    hipblasRowMajorTranspose(trans, A);
+}
+
+// herk type functions: C = op(A) op(A)^H is Hermitian, and C^T = conj(C) = conj(op(A)) op(A)^T
+inline void hipblasRowMajorHerk(hipblasFillMode_t& uplo, hipblasOperation_t& trans)
+{
+    hipblasRowMajorFlip(uplo);
+    hipblasRowMajorConjTranspose(trans);
+}
@@ -0,0 +1,1055 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "handle_state.hpp"
+#include "logging.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace
+{
+    uint32_t hipblas_read_layer_mode()
+    {
+        const char* env = getenv("HIPBLAS_LAYER");
+        if(!env || !*env)
+            return hipblas_layer_mode_none;
+
+        char*         end  = nullptr;
+        unsigned long mode = strtoul(env, &end, 0);
+        if(!*end)
+            return uint32_t(mode);
+
+        static constexpr struct
+        {
+            const char* name;
+            uint32_t    mode;
+        } names[] = {
+            {"bench", hipblas_layer_mode_log_bench},
+            {"profile", hipblas_layer_mode_log_profile},
+            {"record", hipblas_layer_mode_log_record},
+            {"trace", hipblas_layer_mode_log_trace},
+            {"stats", hipblas_layer_mode_stats},
+        };
+
+        uint32_t    layer_mode = hipblas_layer_mode_none;
+        std::string list(env);
+        for(size_t pos = 0; pos < list.size();)
+        {
+            size_t      next = std::min(list.find_first_of(",| ", pos), list.size());
+            std::string name = list.substr(pos, next - pos);
+            for(const auto& entry : names)
+                if(name == entry.name)
+                    layer_mode |= entry.mode;
+            pos = next + 1;
+        }
+        return layer_mode;
+    }
+
+    // Lines go to the file named by the environment variable path_env, or to stderr
+    struct hipblasLogStream
+    {
+        std::mutex mutex;
+        FILE*      file = stderr;
+
+        explicit hipblasLogStream(const char* path_env)
+        {
+            const char* path = getenv(path_env);
+            if(path && *path)
+            {
+                FILE* opened = fopen(path, "w");
+                if(opened)
+                    file = opened;
+                else
+                    fprintf(stderr, "hipBLAS: cannot open %s=%s for logging\n", path_env, path);
+            }
+        }
+
+        ~hipblasLogStream()
+        {
+            if(file != stderr)
+                fclose(file);
+        }
+
+        void write(const std::string& line)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            fputs(line.c_str(), file);
+            fflush(file);
+        }
+    };
+
+    // Never destroyed, so calls made during static destruction can still be logged
+    hipblasLogStream& hipblasGetBenchLogStream()
+    {
+        static hipblasLogStream* stream = new hipblasLogStream("HIPBLAS_LOG_BENCH_PATH");
+        return *stream;
+    }
+
+    /*! \brief Binary trace of the record layer, replayed by hipblas-bench --replay.
+     *
+     *  The file starts with the 8 bytes "hipBLASR" and a uint32_t version, followed by one
+     *  record per call in the order the calls were made. A record is a hipblasLogRecordHeader
+     *  followed by the hipblas-bench command line of the call, without a terminating null.
+     *  Threads, handles and streams are numbered in the order they are first seen; stream 0 is
+     *  the default stream. All fields are in the byte order of the host. The trace goes to the
+     *  file named by HIPBLAS_LOG_RECORD_PATH, or to hipblas_record.bin. hipblas-bench reads the
+     *  same layout, so changes to it need a new version.
+     */
+    constexpr uint32_t hipblas_log_record_version = 1;
+
+    struct hipblasLogRecordHeader
+    {
+        uint32_t line_size; // bytes of the command line that follows
+        uint32_t thread;
+        uint32_t handle;
+        uint32_t stream;
+        uint64_t time_ns; // host time of the call since the first record
+    };
+
+    class hipblasLogRecorder
+    {
+        std::mutex                                    mutex;
+        FILE*                                         file = nullptr;
+        std::unordered_map<std::thread::id, uint32_t> threads;
+        std::unordered_map<hipblasHandle_t, uint32_t> handles;
+        std::unordered_map<hipStream_t, uint32_t>     streams;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        template <typename K>
+        static uint32_t number(std::unordered_map<K, uint32_t>& ids, K key, uint32_t first)
+        {
+            return ids.emplace(key, uint32_t(ids.size()) + first).first->second;
+        }
+
+    public:
+        hipblasLogRecorder()
+        {
+            const char* path = getenv("HIPBLAS_LOG_RECORD_PATH");
+            if(!path || !*path)
+                path = "hipblas_record.bin";
+            file = fopen(path, "wb");
+            if(!file)
+            {
+                fprintf(stderr, "hipBLAS: cannot open %s for recording\n", path);
+                return;
+            }
+            uint32_t version = hipblas_log_record_version;
+            fwrite("hipBLASR", 1, 8, file);
+            fwrite(&version, sizeof(version), 1, file);
+            fflush(file);
+        }
+
+        void add(hipblasHandle_t handle, const std::string& line)
+        {
+            hipStream_t stream = nullptr;
+            hipblasGetStream(handle, &stream);
+            auto now = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!file)
+                return;
+
+            hipblasLogRecordHeader header;
+            header.line_size = uint32_t(line.size());
+            header.thread    = number(threads, std::this_thread::get_id(), 0);
+            header.handle    = number(handles, handle, 0);
+            header.stream    = stream ? number(streams, stream, 1) : 0;
+            header.time_ns   = uint64_t(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count());
+            fwrite(&header, sizeof(header), 1, file);
+            fwrite(line.data(), 1, line.size(), file);
+            fflush(file);
+        }
+    };
+
+    // Never destroyed, so calls made during static destruction can still be recorded
+    hipblasLogRecorder& hipblasGetLogRecorder()
+    {
+        static hipblasLogRecorder* recorder = new hipblasLogRecorder;
+        return *recorder;
+    }
+
+    // One hipBLAS call of the trace and stats layers; times are steady_clock nanoseconds
+    struct hipblasTraceSpan
+    {
+        uint64_t         begin_ns = 0;
+        uint64_t         end_ns   = 0;
+        hipblasHandle_t  handle   = nullptr;
+        hipStream_t      stream   = nullptr;
+        std::string      call; // hipblas-bench command lines of the call, one per line
+        hipblasCallStats stats; // routine and cost of the call, for the stats layer
+    };
+
+    uint64_t hipblasTraceNow()
+    {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    /*! \brief Spans of one thread, written by that thread and read by the flush thread.
+     *
+     *  A single producer, single consumer ring, so the calling thread never takes a lock. When
+     *  the flush thread falls behind, new spans are dropped and counted instead of blocking.
+     */
+    class hipblasTraceRing
+    {
+        std::vector<hipblasTraceSpan> spans;
+        std::atomic<size_t>           head{0}; // next span written by the producer
+        std::atomic<size_t>           tail{0}; // next span read by the consumer
+
+    public:
+        const uint32_t        thread;
+        std::atomic<bool>     closed{false};
+        std::atomic<uint64_t> dropped{0};
+
+        hipblasTraceRing(size_t capacity, uint32_t thread)
+            : spans(capacity)
+            , thread(thread)
+        {
+        }
+
+        // Returns the number of spans waiting, or 0 when span was dropped
+        size_t push(hipblasTraceSpan&& span)
+        {
+            size_t h = head.load(std::memory_order_relaxed);
+            size_t t = tail.load(std::memory_order_acquire);
+            if(h - t == spans.size())
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return 0;
+            }
+            spans[h % spans.size()] = std::move(span);
+            head.store(h + 1, std::memory_order_release);
+            return h + 1 - t;
+        }
+
+        // Passes the waiting spans to f; returns false when there were none
+        template <typename F>
+        bool drain(F f)
+        {
+            size_t t = tail.load(std::memory_order_relaxed);
+            size_t h = head.load(std::memory_order_acquire);
+            for(size_t i = t; i < h; i++)
+                f(spans[i % spans.size()]);
+            tail.store(h, std::memory_order_release);
+            return h != t;
+        }
+
+        size_t capacity() const
+        {
+            return spans.size();
+        }
+    };
+
+    /*! \brief Chrome trace-event JSON of the trace layer.
+     *
+     *  Every outermost hipBLAS call becomes a complete ("X") event named after its routine, with
+     *  the handle, stream, sizes and hipblas-bench command line as args. Timestamps are
+     *  steady_clock microseconds, the clock of std::chrono and of most application tracers, so
+     *  the file can be loaded in chrome://tracing or Perfetto next to application spans. Spans
+     *  are buffered per thread, HIPBLAS_LOG_TRACE_BUFFER spans each, and written by a background
+     *  thread to hipblas_trace.json or the file named by HIPBLAS_LOG_TRACE_PATH. The JSON is
+     *  closed when the process exits.
+     */
+    class hipblasLogTracer
+    {
+        std::mutex                                     mutex; // rings, stopping
+        std::condition_variable                        wake;
+        std::vector<std::shared_ptr<hipblasTraceRing>> rings;
+        uint32_t                                       next_thread = 0;
+        bool                                           stopping    = false;
+        std::thread                                    flusher;
+
+        std::mutex file_mutex; // file, first, dropped
+        FILE*      file    = nullptr;
+        bool       first   = true;
+        uint64_t   dropped = 0;
+
+        size_t capacity = 8192;
+        int    pid      = int(getpid());
+
+        static void escape(std::string& out, const std::string& text)
+        {
+            for(char c : text)
+            {
+                if(c == '"' || c == '\\')
+                    out += '\\';
+                if(c == '\n')
+                    out += "\\n";
+                else
+                    out += c;
+            }
+        }
+
+        static void append_us(std::string& out, uint64_t ns)
+        {
+            char buf[32];
+            snprintf(buf,
+                     sizeof(buf),
+                     "%llu.%03u",
+                     (unsigned long long)(ns / 1000),
+                     unsigned(ns % 1000));
+            out += buf;
+        }
+
+        void write_span(std::string& out, uint32_t thread, const hipblasTraceSpan& span)
+        {
+            // The routine name and the size arguments come from the first command line
+            std::string              name = "hipblas";
+            std::vector<std::string> sizes;
+            std::istringstream       in(span.call.substr(0, span.call.find('\n')));
+            for(std::string option, value; in >> option;)
+            {
+                if(option == "-f" && in >> value)
+                    name = value;
+                else if((option == "-m" || option == "-n" || option == "-k"
+                         || option == "--batch_count")
+                        && in >> value)
+                    sizes.push_back("\"" + option.substr(option.find_first_not_of('-')) + "\":"
+                                    + value);
+            }
+
+            char ids[128];
+            snprintf(ids,
+                     sizeof(ids),
+                     "\"pid\":%d,\"tid\":%u,\"args\":{\"handle\":\"0x%llx\",\"stream\":\"0x%llx\"",
+                     pid,
+                     thread,
+                     (unsigned long long)uintptr_t(span.handle),
+                     (unsigned long long)uintptr_t(span.stream));
+
+            out += first ? "" : ",\n";
+            out += "{\"name\":\"" + name + "\",\"cat\":\"hipblas\",\"ph\":\"X\",\"ts\":";
+            append_us(out, span.begin_ns);
+            out += ",\"dur\":";
+            append_us(out, span.end_ns - span.begin_ns);
+            out += ',';
+            out += ids;
+            for(const auto& size : sizes)
+                out += ',' + size;
+            out += ",\"call\":\"";
+            escape(out, span.call);
+            out += "\"}}";
+            first = false;
+        }
+
+        // Writes out the waiting spans of every thread and forgets threads that have exited
+        void flush()
+        {
+            std::vector<std::shared_ptr<hipblasTraceRing>> current;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                current = rings;
+                rings.erase(std::remove_if(rings.begin(),
+                                           rings.end(),
+                                           [](const auto& ring) { return ring->closed.load(); }),
+                            rings.end());
+            }
+
+            std::lock_guard<std::mutex> lock(file_mutex);
+            if(!file)
+                return;
+            std::string out;
+            for(const auto& ring : current)
+            {
+                ring->drain(
+                    [&](const hipblasTraceSpan& span) { write_span(out, ring->thread, span); });
+                dropped += ring->dropped.exchange(0);
+            }
+            if(!out.empty())
+            {
+                fputs(out.c_str(), file);
+                fflush(file);
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(!stopping)
+            {
+                wake.wait_for(lock, std::chrono::milliseconds(100));
+                lock.unlock();
+                flush();
+                lock.lock();
+            }
+        }
+
+    public:
+        hipblasLogTracer()
+        {
+            const char* path = getenv("HIPBLAS_LOG_TRACE_PATH");
+            if(!path || !*path)
+                path = "hipblas_trace.json";
+            file = fopen(path, "w");
+            if(!file)
+            {
+                fprintf(stderr, "hipBLAS: cannot open %s for tracing\n", path);
+                return;
+            }
+            fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+
+            const char* buffer = getenv("HIPBLAS_LOG_TRACE_BUFFER");
+            if(buffer && strtoull(buffer, nullptr, 0) > 0)
+                capacity = size_t(strtoull(buffer, nullptr, 0));
+
+            flusher = std::thread([this] { run(); });
+        }
+
+        std::shared_ptr<hipblasTraceRing> add_thread()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            rings.push_back(std::make_shared<hipblasTraceRing>(capacity, next_thread++));
+            return rings.back();
+        }
+
+        // Called by a thread whose ring is half full, so it is drained before it overflows
+        void notify()
+        {
+            wake.notify_one();
+        }
+
+        // Stops the flush thread and closes the JSON; later spans are dropped
+        void finish()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_one();
+            if(flusher.joinable())
+                flusher.join();
+            flush();
+
+            std::lock_guard<std::mutex> lock(file_mutex);
+            if(!file)
+                return;
+            fputs("\n]}\n", file);
+            fclose(file);
+            file = nullptr;
+            if(dropped)
+                fprintf(stderr,
+                        "hipBLAS: %llu trace spans dropped; raise HIPBLAS_LOG_TRACE_BUFFER\n",
+                        (unsigned long long)dropped);
+        }
+    };
+
+    // Never destroyed; the trace is closed by an exit handler instead
+    hipblasLogTracer& hipblasGetLogTracer()
+    {
+        static hipblasLogTracer* tracer = [] {
+            auto* created = new hipblasLogTracer;
+            std::atexit([] { hipblasGetLogTracer().finish(); });
+            return created;
+        }();
+        return *tracer;
+    }
+
+    // The open span and the ring of the current thread
+    struct hipblasTraceThread
+    {
+        hipblasTraceSpan                  span;
+        std::shared_ptr<hipblasTraceRing> ring;
+
+        ~hipblasTraceThread()
+        {
+            if(ring)
+                ring->closed = true;
+        }
+    };
+
+    thread_local hipblasTraceThread hipblas_trace_thread;
+
+    // hipblas_common.yaml name of a hipblas-bench option, or nullptr when it has none
+    const char* hipblasLogYamlKey(const std::string& option)
+    {
+        static const std::pair<const char*, const char*> keys[] = {{"-f", "function"},
+                                                                   {"-m", "M"},
+                                                                   {"-n", "N"},
+                                                                   {"-k", "K"},
+                                                                   {"--kl", "KL"},
+                                                                   {"--ku", "KU"},
+                                                                   {"--transposeA", "transA"},
+                                                                   {"--transposeB", "transB"}};
+        for(const auto& key : keys)
+            if(option == key.first)
+                return key.second;
+        return option.compare(0, 2, "--") ? nullptr : option.c_str() + 2;
+    }
+
+    /*! \brief Test entry of hipblas_template.yaml for a hipblas-bench command line.
+     *
+     *  The entry has the fields of hipblas_common.yaml, so a profile can be given to
+     *  hipblas-bench --yaml as is. -r sets every type that is not given on its own.
+     */
+    std::string hipblasLogYamlEntry(const std::string& line, uint64_t count)
+    {
+        std::vector<std::string> tokens;
+        for(size_t pos = 0; pos < line.size();)
+        {
+            size_t next = std::min(line.find(' ', pos), line.size());
+            if(next > pos)
+                tokens.push_back(line.substr(pos, next - pos));
+            pos = next + 1;
+        }
+
+        std::vector<std::pair<std::string, std::string>> fields;
+        auto set = [&](const std::string& key, const std::string& value, bool replace) {
+            for(auto& field : fields)
+                if(field.first == key)
+                {
+                    if(replace)
+                        field.second = value;
+                    return;
+                }
+            fields.emplace_back(key, value);
+        };
+
+        // tokens[0] is the name of the benchmark
+        for(size_t i = 1; i + 1 < tokens.size(); i += 2)
+        {
+            const std::string& option = tokens[i];
+            const std::string& value  = tokens[i + 1];
+            if(option == "-r")
+            {
+                for(const char* key : {"a_type", "b_type", "c_type", "d_type", "compute_type"})
+                    set(key, value, false);
+            }
+            else if(option == "--api")
+                set("api", value == "1" ? "C_64" : "C", true);
+            else if(const char* key = hipblasLogYamlKey(option))
+            {
+                bool is_char = option == "--transposeA" || option == "--transposeB"
+                               || option == "--side" || option == "--uplo" || option == "--diag";
+                set(key, is_char ? "'" + value + "'" : value, true);
+            }
+        }
+
+        std::string entry = "- { ";
+        for(const auto& field : fields)
+            entry += field.first + ": " + field.second + ", ";
+        return entry + "call_count: " + std::to_string(count) + " }\n";
+    }
+
+    /*! \brief Call counts of the profile layer, by hipblas-bench command line.
+     *
+     *  The counts are spread over shards with their own lock, so threads calling different
+     *  routines rarely wait on each other. They are written out as hipblas-bench --yaml test
+     *  entries, most frequent first, to the file named by HIPBLAS_LOG_PROFILE_PATH or to
+     *  stderr when the process exits.
+     */
+    class hipblasLogProfile
+    {
+        struct shard
+        {
+            std::mutex                                mutex;
+            std::unordered_map<std::string, uint64_t> counts;
+        };
+
+        static constexpr size_t num_shards = 64;
+        shard                   shards[num_shards];
+
+    public:
+        void add(const std::string& line)
+        {
+            shard&                      s = shards[std::hash<std::string>{}(line) % num_shards];
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.counts[line]++;
+        }
+
+        void write()
+        {
+            std::vector<std::pair<std::string, uint64_t>> calls;
+            for(auto& s : shards)
+            {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                calls.insert(calls.end(), s.counts.begin(), s.counts.end());
+            }
+            std::stable_sort(calls.begin(), calls.end(), [](const auto& a, const auto& b) {
+                return a.second > b.second;
+            });
+
+            hipblasLogStream stream("HIPBLAS_LOG_PROFILE_PATH");
+            for(const auto& call : calls)
+                stream.write(hipblasLogYamlEntry(call.first, call.second));
+        }
+    };
+
+    // Never destroyed; the profile is written out by an exit handler instead
+    hipblasLogProfile& hipblasGetLogProfile()
+    {
+        static hipblasLogProfile* profile = [] {
+            auto* created = new hipblasLogProfile;
+            std::atexit([] { hipblasGetLogProfile().write(); });
+            return created;
+        }();
+        return *profile;
+    }
+
+    // hipDataType of a legacy hipblasDatatype_t; false for HIPBLAS_DATATYPE_INVALID
+    bool hipblasLogDatatype(hipblasDatatype_t type, hipDataType& hip_type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            hip_type = HIP_R_16F;
+            return true;
+        case HIPBLAS_R_32F:
+            hip_type = HIP_R_32F;
+            return true;
+        case HIPBLAS_R_64F:
+            hip_type = HIP_R_64F;
+            return true;
+        case HIPBLAS_C_16F:
+            hip_type = HIP_C_16F;
+            return true;
+        case HIPBLAS_C_32F:
+            hip_type = HIP_C_32F;
+            return true;
+        case HIPBLAS_C_64F:
+            hip_type = HIP_C_64F;
+            return true;
+        case HIPBLAS_R_8I:
+            hip_type = HIP_R_8I;
+            return true;
+        case HIPBLAS_R_8U:
+            hip_type = HIP_R_8U;
+            return true;
+        case HIPBLAS_R_32I:
+            hip_type = HIP_R_32I;
+            return true;
+        case HIPBLAS_R_32U:
+            hip_type = HIP_R_32U;
+            return true;
+        case HIPBLAS_C_8I:
+            hip_type = HIP_C_8I;
+            return true;
+        case HIPBLAS_C_8U:
+            hip_type = HIP_C_8U;
+            return true;
+        case HIPBLAS_C_32I:
+            hip_type = HIP_C_32I;
+            return true;
+        case HIPBLAS_C_32U:
+            hip_type = HIP_C_32U;
+            return true;
+        case HIPBLAS_R_16B:
+            hip_type = HIP_R_16BF;
+            return true;
+        case HIPBLAS_C_16B:
+            hip_type = HIP_C_16BF;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    float hipblasLogHalfToFloat(uint16_t bits)
+    {
+        uint32_t sign     = uint32_t(bits & 0x8000) << 16;
+        uint32_t exponent = (bits >> 10) & 0x1f;
+        uint32_t mantissa = bits & 0x3ff;
+        if(exponent == 0x1f)
+            exponent = 0xff;
+        else if(exponent)
+            exponent += 127 - 15;
+        else if(mantissa)
+        {
+            // Subnormal half; normalize it
+            exponent = 127 - 15 + 1;
+            while(!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            mantissa &= 0x3ff;
+        }
+        uint32_t f = sign | exponent << 23 | mantissa << 13;
+        float    value;
+        memcpy(&value, &f, sizeof(value));
+        return value;
+    }
+
+    template <typename T>
+    T hipblasLogLoad(const void* ptr, size_t index)
+    {
+        T value;
+        memcpy(&value, static_cast<const char*>(ptr) + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    // Real part of a scalar, or its imaginary part when part is 1
+    bool hipblasLogScalarPart(std::ostringstream& out, const hipblas_log_scalar& scalar, int part)
+    {
+        switch(scalar.type)
+        {
+        case HIP_R_16F:
+        case HIP_C_16F:
+            out << hipblasLogHalfToFloat(hipblasLogLoad<uint16_t>(scalar.value, part));
+            return true;
+        case HIP_R_16BF:
+        case HIP_C_16BF:
+        {
+            uint32_t bits = uint32_t(hipblasLogLoad<uint16_t>(scalar.value, part)) << 16;
+            float    value;
+            memcpy(&value, &bits, sizeof(value));
+            out << value;
+            return true;
+        }
+        case HIP_R_32F:
+        case HIP_C_32F:
+            out.precision(std::numeric_limits<float>::max_digits10);
+            out << hipblasLogLoad<float>(scalar.value, part);
+            return true;
+        case HIP_R_64F:
+        case HIP_C_64F:
+            out.precision(std::numeric_limits<double>::max_digits10);
+            out << hipblasLogLoad<double>(scalar.value, part);
+            return true;
+        case HIP_R_32I:
+        case HIP_C_32I:
+            out << hipblasLogLoad<int32_t>(scalar.value, part);
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+uint32_t hipblas_layer_mode = hipblas_read_layer_mode();
+
+thread_local int hipblas_log_depth = 0;
+
+#ifndef HIPBLAS_V2
+hipblas_log_scalar::hipblas_log_scalar(const char* name, const void* value, hipblasDatatype_t type)
+    : name(name)
+    , value(value)
+    , type(HIP_R_32F)
+{
+    if(!hipblasLogDatatype(type, this->type))
+        this->value = nullptr;
+}
+#endif
+
+hipblas_log_scalar::hipblas_log_scalar(const char*          name,
+                                       const void*          value,
+                                       hipblasComputeType_t compute_type,
+                                       hipDataType          c_type)
+    : name(name)
+    , value(value)
+{
+    bool complex = c_type == HIP_C_16F || c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        type = complex ? HIP_C_16F : HIP_R_16F;
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        type = complex ? HIP_C_64F : HIP_R_64F;
+        break;
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        type = HIP_R_32I;
+        break;
+    default:
+        type = complex ? HIP_C_32F : HIP_R_32F;
+        break;
+    }
+}
+
+std::string hipblas_log_string(hipblasOperation_t op, bool)
+{
+    return op == HIPBLAS_OP_N ? "N" : op == HIPBLAS_OP_T ? "T" : "C";
+}
+
+std::string hipblas_log_string(hipblasFillMode_t fill, bool)
+{
+    return fill == HIPBLAS_FILL_MODE_UPPER ? "U" : fill == HIPBLAS_FILL_MODE_LOWER ? "L" : "F";
+}
+
+std::string hipblas_log_string(hipblasDiagType_t diag, bool)
+{
+    return diag == HIPBLAS_DIAG_UNIT ? "U" : "N";
+}
+
+std::string hipblas_log_string(hipblasSideMode_t side, bool)
+{
+    return side == HIPBLAS_SIDE_LEFT ? "L" : side == HIPBLAS_SIDE_RIGHT ? "R" : "B";
+}
+
+// Same names as the precisions accepted by hipblas-bench
+static const char* hipblasLogTypeName(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return "f16_r";
+    case HIP_R_32F:
+        return "f32_r";
+    case HIP_R_64F:
+        return "f64_r";
+    case HIP_C_16F:
+        return "f16_c";
+    case HIP_C_32F:
+        return "f32_c";
+    case HIP_C_64F:
+        return "f64_c";
+    case HIP_R_8I:
+        return "i8_r";
+    case HIP_R_8U:
+        return "u8_r";
+    case HIP_R_32I:
+        return "i32_r";
+    case HIP_R_32U:
+        return "u32_r";
+    case HIP_C_8I:
+        return "i8_c";
+    case HIP_C_8U:
+        return "u8_c";
+    case HIP_C_32I:
+        return "i32_c";
+    case HIP_C_32U:
+        return "u32_c";
+    case HIP_R_16BF:
+        return "bf16_r";
+    case HIP_C_16BF:
+        return "bf16_c";
+    default:
+        return "invalid";
+    }
+}
+
+std::string hipblas_log_string(hipDataType type, bool)
+{
+    return hipblasLogTypeName(type);
+}
+
+#ifndef HIPBLAS_V2
+std::string hipblas_log_string(hipblasDatatype_t type, bool host_scalars)
+{
+    hipDataType hip_type;
+    return hipblasLogDatatype(type, hip_type) ? hipblas_log_string(hip_type, host_scalars)
+                                              : "invalid";
+}
+#endif
+
+std::string hipblas_log_string(hipblasComputeType_t type, bool)
+{
+    switch(type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+        return "c16f";
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return "c16f_pedantic";
+    case HIPBLAS_COMPUTE_32F:
+        return "c32f";
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+        return "c32f_pedantic";
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+        return "c32f_fast_16f";
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+        return "c32f_fast_16Bf";
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return "c32f_fast_tf32";
+    case HIPBLAS_COMPUTE_64F:
+        return "c64f";
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return "c64f_pedantic";
+    case HIPBLAS_COMPUTE_32I:
+        return "c32i";
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return "c32i_pedantic";
+    default:
+        return "invalid";
+    }
+}
+
+std::string hipblas_log_string(hipblasGemmAlgo_t algo, bool)
+{
+    return std::to_string(int(algo));
+}
+
+std::string hipblas_log_string(hipblasGemmFlags_t flags, bool)
+{
+    return std::to_string(uint32_t(flags));
+}
+
+std::string hipblas_log_string(const hipblas_log_scalar& scalar, bool host_scalars)
+{
+    if(!host_scalars || !scalar.value)
+        return "";
+
+    std::ostringstream out;
+    out << "--" << scalar.name << ' ';
+    if(!hipblasLogScalarPart(out, scalar, 0))
+        return "";
+
+    if(scalar.type == HIP_C_16F || scalar.type == HIP_C_16BF || scalar.type == HIP_C_32F
+       || scalar.type == HIP_C_64F || scalar.type == HIP_C_32I)
+    {
+        out << " --" << scalar.name << "i ";
+        hipblasLogScalarPart(out, scalar, 1);
+    }
+    return out.str();
+}
+
+std::string hipblas_log_string(const char* text, bool)
+{
+    return text;
+}
+
+hipblas_log_value hipblas_log_stats_value(hipblasOperation_t op)
+{
+    return {0, op == HIPBLAS_OP_N ? "N" : op == HIPBLAS_OP_T ? "T" : "C"};
+}
+
+hipblas_log_value hipblas_log_stats_value(hipblasSideMode_t side)
+{
+    return {0, side == HIPBLAS_SIDE_LEFT ? "L" : side == HIPBLAS_SIDE_RIGHT ? "R" : "B"};
+}
+
+hipblas_log_value hipblas_log_stats_value(hipDataType type)
+{
+    return {0, hipblasLogTypeName(type)};
+}
+
+#ifndef HIPBLAS_V2
+hipblas_log_value hipblas_log_stats_value(hipblasDatatype_t type)
+{
+    hipDataType hip_type;
+    return {0, hipblasLogDatatype(type, hip_type) ? hipblasLogTypeName(hip_type) : "invalid"};
+}
+#endif
+
+hipblas_log_value hipblas_log_stats_value(const char* text)
+{
+    return {0, text};
+}
+
+bool hipblas_log_host_scalars(hipblasHandle_t handle)
+{
+    hipblasPointerMode_t mode;
+    return hipblasGetPointerMode(handle, &mode) == HIPBLAS_STATUS_SUCCESS
+           && mode == HIPBLAS_POINTER_MODE_HOST;
+}
+
+void hipblas_log_call(hipblasHandle_t   handle,
+                      const char*       format,
+                      const std::string args[],
+                      size_t            count)
+{
+    std::string line;
+    size_t      arg = 0;
+    for(const char* c = format; *c; c++)
+    {
+        if(c[0] == '{' && c[1] == '}' && arg < count)
+        {
+            // Arguments that are left out, such as device scalars, leave no gap behind
+            if(args[arg].empty() && c[2] == ' ')
+                c++;
+            line += args[arg++];
+            c++;
+        }
+        else
+            line += *c;
+    }
+
+    if(hipblas_layer_mode & hipblas_layer_mode_log_profile)
+        hipblasGetLogProfile().add(line);
+    if(hipblas_layer_mode & hipblas_layer_mode_log_record)
+        hipblasGetLogRecorder().add(handle, line);
+    if(hipblas_layer_mode & hipblas_layer_mode_log_trace)
+    {
+        hipblasTraceSpan& span = hipblas_trace_thread.span;
+        if(span.call.empty())
+        {
+            span.handle = handle;
+            hipblasGetStream(handle, &span.stream);
+        }
+        else
+            span.call += '\n';
+        span.call += line;
+    }
+    if(hipblas_layer_mode & hipblas_layer_mode_log_bench)
+        hipblasGetBenchLogStream().write(line + '\n');
+}
+
+void hipblas_log_stats(hipblasHandle_t         handle,
+                       const char*             format,
+                       const hipblas_log_value values[],
+                       size_t                  count)
+{
+    hipblasTraceSpan& span = hipblas_trace_thread.span;
+    if(!span.handle)
+        span.handle = handle;
+    hipblasHandleStatsCount(span.stats, format, values, count);
+}
+
+void hipblas_log_span_begin()
+{
+    hipblas_trace_thread.span.begin_ns = hipblasTraceNow();
+}
+
+void hipblas_log_span_end()
+{
+    hipblasTraceThread& thread = hipblas_trace_thread;
+    thread.span.end_ns         = hipblasTraceNow();
+
+    if((hipblas_layer_mode & hipblas_layer_mode_stats) && thread.span.stats.function)
+        hipblasHandleStatsAdd(
+            thread.span.handle, thread.span.stats, thread.span.end_ns - thread.span.begin_ns);
+
+    if(hipblas_layer_mode & hipblas_layer_mode_log_trace)
+    {
+        hipblasLogTracer& tracer = hipblasGetLogTracer();
+        if(!thread.ring)
+            thread.ring = tracer.add_thread();
+        if(thread.ring->push(std::move(thread.span)) * 2 == thread.ring->capacity())
+            tracer.notify();
+    }
+    thread.span = hipblasTraceSpan();
+}
@@ -0,0 +1,597 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_batched.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <tuple>
+
+namespace
+{
+    size_t hipblas_stream_pool_size()
+    {
+        static const size_t size = [] {
+            const char* env = std::getenv("HIPBLAS_NVIDIA_NUM_STREAMS");
+            return env ? size_t(std::max(0, std::atoi(env))) : size_t(4);
+        }();
+        return size;
+    }
+
+    template <typename T>
+    void hipblas_store_pair(char* dst, T one, T zero)
+    {
+        std::memcpy(dst, &one, sizeof(T));
+        std::memcpy(dst + sizeof(T), &zero, sizeof(T));
+    }
+}
+
+hipblas_stream_pool::~hipblas_stream_pool()
+{
+    for(cublasHandle_t h : m_handles)
+        cublasDestroy(h);
+    for(cudaStream_t s : m_streams)
+        cudaStreamDestroy(s);
+    for(cudaEvent_t e : m_events)
+        cudaEventDestroy(e);
+    if(m_fork)
+        cudaEventDestroy(m_fork);
+    if(m_device_constants)
+        cudaFree(m_device_constants);
+}
+
+hipblas_stream_pool* hipblas_stream_pool::get(hipblasHandle_t handle)
+{
+    hipblasHandleState*         state = hipblasGetHandleState(handle);
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    if(!state->backend)
+    {
+        std::unique_ptr<hipblas_stream_pool> pool(new hipblas_stream_pool);
+        if(pool->init(hipblas_stream_pool_size()) != HIPBLAS_STATUS_SUCCESS)
+            return nullptr;
+        state->backend = std::move(pool);
+    }
+    return static_cast<hipblas_stream_pool*>(state->backend.get());
+}
+
+hipblasStatus_t hipblas_stream_pool::init(size_t count)
+{
+    std::memset(m_host_constants, 0, sizeof(m_host_constants));
+    hipblas_store_pair(m_host_constants, 1.0f, 0.0f);
+    hipblas_store_pair(m_host_constants + 32, 1.0, 0.0);
+    hipblas_store_pair(m_host_constants + 64, cuComplex{1.0f, 0.0f}, cuComplex{0.0f, 0.0f});
+    hipblas_store_pair(m_host_constants + 96, cuDoubleComplex{1.0, 0.0}, cuDoubleComplex{0.0, 0.0});
+
+    if(cudaMalloc(&m_device_constants, sizeof(m_host_constants)) != cudaSuccess
+       || cudaMemcpy(m_device_constants,
+                     m_host_constants,
+                     sizeof(m_host_constants),
+                     cudaMemcpyHostToDevice)
+              != cudaSuccess
+       || cudaEventCreateWithFlags(&m_fork, cudaEventDisableTiming) != cudaSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    for(size_t i = 0; i < count; i++)
+    {
+        cudaStream_t stream;
+        if(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking) != cudaSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        m_streams.push_back(stream);
+
+        cudaEvent_t event;
+        if(cudaEventCreateWithFlags(&event, cudaEventDisableTiming) != cudaSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        m_events.push_back(event);
+
+        cublasHandle_t handle;
+        if(cublasCreate(&handle) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        m_handles.push_back(handle);
+
+        if(cublasSetStream(handle, stream) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_stream_pool::fork(hipblasHandle_t handle, size_t count)
+{
+    cublasHandle_t      main = (cublasHandle_t)handle;
+    cudaStream_t        stream;
+    cublasPointerMode_t pointer_mode;
+    cublasMath_t        math_mode;
+    cublasAtomicsMode_t atomics_mode;
+    if(cublasGetStream(main, &stream) != CUBLAS_STATUS_SUCCESS
+       || cublasGetPointerMode(main, &pointer_mode) != CUBLAS_STATUS_SUCCESS
+       || cublasGetMathMode(main, &math_mode) != CUBLAS_STATUS_SUCCESS
+       || cublasGetAtomicsMode(main, &atomics_mode) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(cudaEventRecord(m_fork, stream) != cudaSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(size_t i = 0; i < count; i++)
+    {
+        if(cublasSetPointerMode(m_handles[i], pointer_mode) != CUBLAS_STATUS_SUCCESS
+           || cublasSetMathMode(m_handles[i], math_mode) != CUBLAS_STATUS_SUCCESS
+           || cublasSetAtomicsMode(m_handles[i], atomics_mode) != CUBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(cudaStreamWaitEvent(m_streams[i], m_fork, 0) != cudaSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_stream_pool::join(hipblasHandle_t handle, size_t count)
+{
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(size_t i = 0; i < count; i++)
+    {
+        if(cudaEventRecord(m_events[i], m_streams[i]) != cudaSuccess
+           || cudaStreamWaitEvent(stream, m_events[i], 0) != cudaSuccess)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return status;
+}
+
+size_t hipblas_datatype_size(cudaDataType_t type)
+{
+    switch(type)
+    {
+    case CUDA_R_8I:
+    case CUDA_R_8U:
+        return 1;
+    case CUDA_R_16F:
+    case CUDA_R_16BF:
+    case CUDA_C_8I:
+    case CUDA_C_8U:
+        return 2;
+    case CUDA_R_32F:
+    case CUDA_R_32I:
+    case CUDA_C_16F:
+    case CUDA_C_16BF:
+        return 4;
+    case CUDA_R_64F:
+    case CUDA_C_32F:
+    case CUDA_C_32I:
+        return 8;
+    case CUDA_C_64F:
+        return 16;
+    default:
+        break;
+    }
+    throw HIPBLAS_STATUS_INVALID_ENUM;
+}
+
+hipblas_dense_expansion
+    hipblas_gbmv_expansion(int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t lda)
+{
+    // Diagonal d of A is a strip with step lda in the band storage and step m + 1 in the dense
+    // matrix; the dense stride is a multiple of that step so a strip maps onto a 3D copy
+    hipblas_dense_expansion expansion{m, (m + 1) * n, {}};
+    if(m <= 0 || n <= 0 || kl < 0 || ku < 0 || lda < kl + ku + 1)
+        return expansion;
+    for(int64_t d = 0; d <= ku && d < n; d++)
+        expansion.strips.push_back({ku - d + d * lda, lda, d * m, m + 1, std::min(m, n - d)});
+    for(int64_t d = 1; d <= kl && d < m; d++)
+        expansion.strips.push_back({ku + d, lda, d, m + 1, std::min(m - d, n)});
+    return expansion;
+}
+
+hipblas_dense_expansion
+    hipblas_sbmv_expansion(hipblasFillMode_t uplo, int64_t n, int64_t k, int64_t lda)
+{
+    // Each stored diagonal is written to the dense matrix twice, once above and once below
+    // the main diagonal
+    hipblas_dense_expansion expansion{n, (n + 1) * n, {}};
+    if(n <= 0 || k < 0 || lda < k + 1)
+        return expansion;
+    for(int64_t d = 0; d <= k && d < n; d++)
+    {
+        int64_t offset = uplo == HIPBLAS_FILL_MODE_UPPER ? k - d + d * lda : d;
+        expansion.strips.push_back({offset, lda, d * n, n + 1, n - d});
+        if(d)
+            expansion.strips.push_back({offset, lda, d, n + 1, n - d});
+    }
+    return expansion;
+}
+
+hipblas_dense_expansion hipblas_spmv_expansion(hipblasFillMode_t uplo, int64_t n)
+{
+    // Each packed column is written to the dense matrix as a column and as a row
+    hipblas_dense_expansion expansion{n, n * n, {}};
+    for(int64_t j = 0; j < n; j++)
+    {
+        bool    upper  = uplo == HIPBLAS_FILL_MODE_UPPER;
+        int64_t offset = upper ? j * (j + 1) / 2 : j * (2 * n - j + 1) / 2;
+        int64_t len    = upper ? j + 1 : n - j;
+        int64_t first  = upper ? j * n : j + j * n;
+        expansion.strips.push_back({offset, 1, first, 1, len});
+        expansion.strips.push_back({offset, 1, upper ? j : first, n, len});
+    }
+    return expansion;
+}
+
+hipblasStatus_t hipblas_expand_strided_batched(cudaStream_t                   stream,
+                                               size_t                         size,
+                                               const void*                    src,
+                                               hipblasStride                  src_stride,
+                                               void*                          dense,
+                                               const hipblas_dense_expansion& expansion,
+                                               int64_t                        batch_count)
+{
+    // A strip is one 3D copy: len rows of one element, step elements apart, repeated over the
+    // batch, which needs each stride to be a whole number of steps. Contiguous strips are
+    // copied as a single row instead.
+    std::vector<cudaMemcpy3DParms> copies;
+    for(const auto& s : expansion.strips)
+    {
+        bool    row       = s.src_step == 1 && s.dst_step == 1;
+        int64_t src_pitch = row ? src_stride : s.src_step;
+        int64_t dst_pitch = row ? expansion.stride : s.dst_step;
+        int64_t width     = row ? s.len : 1;
+        if(src_stride % src_pitch || expansion.stride % dst_pitch
+           || (row && (src_stride < s.len || expansion.stride < s.len)))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        cudaMemcpy3DParms copy = {};
+
+        copy.srcPtr = make_cudaPitchedPtr((char*)src + size * s.src_offset,
+                                          size * src_pitch,
+                                          size * width,
+                                          src_stride / src_pitch);
+        copy.dstPtr = make_cudaPitchedPtr((char*)dense + size * s.dst_offset,
+                                          size * dst_pitch,
+                                          size * width,
+                                          expansion.stride / dst_pitch);
+        copy.extent = make_cudaExtent(size * width, row ? 1 : s.len, batch_count);
+        copy.kind   = cudaMemcpyDeviceToDevice;
+        copies.push_back(copy);
+    }
+
+    if(cudaMemsetAsync(dense, 0, size * expansion.stride * batch_count, stream) != cudaSuccess)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    for(const auto& copy : copies)
+    {
+        if(cudaMemcpy3DAsync(&copy, stream) != cudaSuccess)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+bool hipblas_may_allocate(hipblasHandle_t handle, cudaStream_t stream)
+{
+    if(hipblasGetHandleState(handle)->graph_capture_mode == HIPBLAS_GRAPH_CAPTURE_SAFE)
+        return false;
+
+    cudaStreamCaptureStatus capture;
+    return cudaStreamIsCapturing(stream, &capture) == cudaSuccess
+           && capture == cudaStreamCaptureStatusNone;
+}
+
+hipblasStatus_t hipblas_batch::append(hipblasHandle_t           handle,
+                                      cudaStream_t              stream,
+                                      int64_t                   batch_count,
+                                      std::vector<const void*>& pointers) const
+{
+    size_t first = pointers.size();
+    pointers.resize(first + batch_count);
+    if(!m_array)
+    {
+        for(int64_t b = 0; b < batch_count; b++)
+            pointers[first + b] = static_cast<const char*>(m_base) + b * m_stride_bytes;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The read back below cannot be captured into a graph
+    if(!hipblas_may_allocate(handle, stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(cudaMemcpyAsync(pointers.data() + first,
+                       m_array,
+                       sizeof(const void*) * batch_count,
+                       cudaMemcpyDeviceToHost,
+                       stream)
+           != cudaSuccess
+       || cudaStreamSynchronize(stream) != cudaSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // Calls leaf(i) for every diagonal element and node(first, mid, last, level) for every split
+    // of [first, last) into [first, mid) and [mid, last), halving down to single elements
+    template <typename L, typename N>
+    void hipblas_split(int64_t first, int64_t last, int level, L& leaf, N& node)
+    {
+        if(last - first == 1)
+        {
+            leaf(first);
+            return;
+        }
+
+        int64_t mid = first + (last - first + 1) / 2;
+        hipblas_split(first, mid, level + 1, leaf, node);
+        hipblas_split(mid, last, level + 1, leaf, node);
+        node(first, mid, last, level);
+    }
+
+    template <typename L, typename N>
+    void hipblas_split(int64_t n, L&& leaf, N&& node)
+    {
+        if(n > 0)
+            hipblas_split(0, n, 0, leaf, node);
+    }
+}
+
+std::vector<hipblas_gemm_task> hipblas_syr2k_tasks(hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t trans,
+                                                   int64_t            n,
+                                                   int64_t            k,
+                                                   bool               rank2)
+{
+    using task = hipblas_gemm_task;
+
+    // C(I, J) = alpha * op(A)(I, :) op(B)(J, :)^T, where row r of op(X) starts at X(r, 0), or
+    // at X(0, r) when transposed
+    bool                           notrans = trans == HIPBLAS_OP_N;
+    hipblasOperation_t             transA  = notrans ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t             transB  = notrans ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    std::vector<hipblas_gemm_task> tasks;
+
+    auto tile = [&](int64_t i, int64_t mi, int64_t j, int64_t nj) {
+        int64_t ir = notrans ? i : 0, ic = notrans ? 0 : i;
+        int64_t jr = notrans ? j : 0, jc = notrans ? 0 : j;
+        tasks.push_back({0, transA, transB, mi, nj, k, task::A, ir, ic, task::B, jr, jc, i, j,
+                         task::BETA});
+        if(rank2)
+            tasks.push_back({1, transA, transB, mi, nj, k, task::B, ir, ic, task::A, jr, jc, i, j,
+                             task::BETA_ONE});
+    };
+
+    hipblas_split(
+        n,
+        [&](int64_t i) { tile(i, 1, i, 1); },
+        [&](int64_t first, int64_t mid, int64_t last, int) {
+            if(uplo == HIPBLAS_FILL_MODE_UPPER)
+                tile(first, mid - first, mid, last - mid);
+            else
+                tile(mid, last - mid, first, mid - first);
+        });
+    return tasks;
+}
+
+std::vector<hipblas_gemm_task>
+    hipblas_symm_tasks(hipblasSideMode_t side, hipblasFillMode_t uplo, int64_t m, int64_t n)
+{
+    using task = hipblas_gemm_task;
+
+    // Every stored off-diagonal block A(R, Q) also stands for A(Q, R) = A(R, Q)^T
+    bool                           left = side == HIPBLAS_SIDE_LEFT;
+    std::vector<hipblas_gemm_task> tasks;
+
+    auto leaf = [&](int64_t i) {
+        if(left)
+            tasks.push_back({0, HIPBLAS_OP_N, HIPBLAS_OP_N, 1, n, 1, task::A, i, i, task::B, i, 0,
+                             i, 0, task::BETA});
+        else
+            tasks.push_back({0, HIPBLAS_OP_N, HIPBLAS_OP_N, m, 1, 1, task::B, 0, i, task::A, i, i,
+                             0, i, task::BETA});
+    };
+
+    auto node = [&](int64_t first, int64_t mid, int64_t last, int level) {
+        bool    upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+        int64_t r = upper ? first : mid, nr = upper ? mid - first : last - mid;
+        int64_t q = upper ? mid : first, nq = upper ? last - mid : mid - first;
+        if(left)
+        {
+            tasks.push_back({1 + level, HIPBLAS_OP_N, HIPBLAS_OP_N, nr, n, nq, task::A, r, q,
+                             task::B, q, 0, r, 0, task::BETA_ONE});
+            tasks.push_back({1 + level, HIPBLAS_OP_T, HIPBLAS_OP_N, nq, n, nr, task::A, r, q,
+                             task::B, r, 0, q, 0, task::BETA_ONE});
+        }
+        else
+        {
+            tasks.push_back({1 + level, HIPBLAS_OP_N, HIPBLAS_OP_N, m, nq, nr, task::B, 0, r,
+                             task::A, r, q, 0, q, task::BETA_ONE});
+            tasks.push_back({1 + level, HIPBLAS_OP_N, HIPBLAS_OP_T, m, nr, nq, task::B, 0, q,
+                             task::A, r, q, 0, r, task::BETA_ONE});
+        }
+    };
+
+    hipblas_split(left ? m : n, leaf, node);
+    return tasks;
+}
+
+std::vector<hipblas_gemm_task> hipblas_trmm_tasks(hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t trans,
+                                                  hipblasDiagType_t  diag,
+                                                  int64_t            m,
+                                                  int64_t            n)
+{
+    using task = hipblas_gemm_task;
+
+    // The diagonal writes every row (left) or column (right) of C, then each level of
+    // off-diagonal blocks of op(A) accumulates into it. Block op(A)(R, Q) is stored at A(R, Q),
+    // or at A(Q, R) when transposed.
+    bool                           left    = side == HIPBLAS_SIDE_LEFT;
+    bool                           notrans = trans == HIPBLAS_OP_N;
+    bool                           upper   = (uplo == HIPBLAS_FILL_MODE_UPPER) == notrans;
+    bool                           unit    = diag == HIPBLAS_DIAG_UNIT;
+    std::vector<hipblas_gemm_task> tasks;
+
+    auto leaf = [&](int64_t i) {
+        task::operand a = unit ? task::ONE : task::A;
+        int64_t       d = unit ? 0 : i;
+        if(left)
+            tasks.push_back(
+                {0, trans, HIPBLAS_OP_N, 1, n, 1, a, d, d, task::B, i, 0, i, 0, task::BETA_ZERO});
+        else
+            tasks.push_back(
+                {0, HIPBLAS_OP_N, trans, m, 1, 1, task::B, 0, i, a, d, d, 0, i, task::BETA_ZERO});
+    };
+
+    auto node = [&](int64_t first, int64_t mid, int64_t last, int level) {
+        int64_t r = upper ? first : mid, nr = upper ? mid - first : last - mid;
+        int64_t q = upper ? mid : first, nq = upper ? last - mid : mid - first;
+        int64_t ar = notrans ? r : q, ac = notrans ? q : r;
+        if(left)
+            tasks.push_back({1 + level, trans, HIPBLAS_OP_N, nr, n, nq, task::A, ar, ac, task::B,
+                             q, 0, r, 0, task::BETA_ONE});
+        else
+            tasks.push_back({1 + level, HIPBLAS_OP_N, trans, m, nq, nr, task::B, 0, r, task::A,
+                             ar, ac, 0, q, task::BETA_ONE});
+    };
+
+    hipblas_split(left ? m : n, leaf, node);
+    return tasks;
+}
+
+hipblasStatus_t hipblas_gemm_tasks_execute(hipblasHandle_t                       handle,
+                                           const std::vector<hipblas_gemm_task>& tasks,
+                                           const hipblas_gemm_task_args&         args,
+                                           int64_t                               batch_count)
+{
+    using task = hipblas_gemm_task;
+
+    // Tasks sharing everything but their positions form one pointer-array GEMM; the phase
+    // leads the key so that groups are issued in phase order
+    using key = std::tuple<int,
+                           hipblasOperation_t,
+                           hipblasOperation_t,
+                           int64_t,
+                           int64_t,
+                           int64_t,
+                           task::operand,
+                           task::operand,
+                           task::scale>;
+    std::map<key, std::vector<const task*>> groups;
+    for(const task& t : tasks)
+        groups[key(t.phase, t.transA, t.transB, t.m, t.n, t.k, t.left, t.right, t.beta)]
+            .push_back(&t);
+
+    for(const auto& group : groups)
+    {
+        const task& t = *group.second.front();
+        if(t.m > INT32_MAX || t.n > INT32_MAX || t.k > INT32_MAX
+           || int64_t(group.second.size()) * batch_count > INT32_MAX)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    if(args.lda > INT32_MAX || args.ldb > INT32_MAX || args.ldc > INT32_MAX)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // Pointers to the instances of A, B and C, one after the other
+    std::vector<const void*> instances;
+    for(const hipblas_batch* operand : {&args.A, &args.B, &args.C})
+    {
+        hipblasStatus_t status = operand->append(handle, stream, batch_count, instances);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    size_t  size   = args.size;
+    int64_t lds[3] = {args.lda, args.ldb, 1};
+
+    auto element = [&](task::operand x, int64_t b, int64_t row, int64_t col) -> const void* {
+        if(x == task::ONE)
+            return args.device_one;
+        return static_cast<const char*>(instances[x * batch_count + b])
+               + size * (row + col * lds[x]);
+    };
+
+    // The left, right and C arrays of every group, one after the other
+    std::vector<const void*> pointers;
+    for(const auto& group : groups)
+    {
+        for(const task* t : group.second)
+            for(int64_t b = 0; b < batch_count; b++)
+                pointers.push_back(element(t->left, b, t->left_row, t->left_col));
+        for(const task* t : group.second)
+            for(int64_t b = 0; b < batch_count; b++)
+                pointers.push_back(element(t->right, b, t->right_row, t->right_col));
+        for(const task* t : group.second)
+            for(int64_t b = 0; b < batch_count; b++)
+                pointers.push_back(static_cast<const char*>(instances[2 * batch_count + b])
+                                   + size * (t->c_row + t->c_col * args.ldc));
+    }
+
+    size_t                bytes = sizeof(const void*) * pointers.size();
+    hipblas_stream_buffer arrays(handle, stream, bytes);
+    if(!arrays.get()
+       || cudaMemcpyAsync(arrays.get(), pointers.data(), bytes, cudaMemcpyHostToDevice, stream)
+              != cudaSuccess)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    const void** next = static_cast<const void**>(arrays.get());
+    for(const auto& group : groups)
+    {
+        const task& t     = *group.second.front();
+        int         count = int(group.second.size() * batch_count);
+
+        hipblasStatus_t status = hipblasGemmBatchedEx_v2(handle,
+                                                         t.transA,
+                                                         t.transB,
+                                                         int(t.m),
+                                                         int(t.n),
+                                                         int(t.k),
+                                                         args.alpha,
+                                                         next,
+                                                         args.type,
+                                                         int(lds[t.left]),
+                                                         next + count,
+                                                         args.type,
+                                                         int(lds[t.right]),
+                                                         args.beta[t.beta],
+                                                         (void**)(next + 2 * count),
+                                                         args.type,
+                                                         int(args.ldc),
+                                                         count,
+                                                         args.compute_type,
+                                                         HIPBLAS_GEMM_DEFAULT);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        next += 3 * count;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+int64_t hipblas_ilp64_chunk()
+{
+    static const int64_t chunk = [] {
+        const char* env  = std::getenv("HIPBLAS_NVIDIA_ILP64_CHUNK");
+        long long   size = env ? std::atoll(env) : 0;
+        return size > 0 && size < INT32_MAX ? int64_t(size) : int64_t(INT32_MAX);
+    }();
+    return chunk;
+}
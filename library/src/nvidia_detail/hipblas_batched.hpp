@@ -0,0 +1,952 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle_state.hpp"
+#include "hipblas.h"
+#include <algorithm>
+#include <cstdint>
+#include <cublas_v2.h>
+#include <cuda_runtime_api.h>
+#include <initializer_list>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+/*! \brief Auxiliary cuBLAS handles, each bound to its own stream, used to overlap the
+ *         instances of batched calls that cuBLAS has no batched routine for.
+ *
+ *  A pool belongs to one hipblasHandle_t and is created the first time it is needed. Before a
+ *  batch runs, every auxiliary stream waits for the work already queued on the stream of the
+ *  handle, and afterwards that stream waits for all of them, so the batch is ordered exactly as
+ *  if it had been queued on the handle. The number of streams defaults to 4 and can be set with
+ *  the HIPBLAS_NVIDIA_NUM_STREAMS environment variable; 0 runs batches serially on the handle.
+ */
+class hipblas_stream_pool : public hipblasBackendState
+{
+public:
+    ~hipblas_stream_pool() override;
+
+    // Returns the pool of handle, creating it if needed; nullptr if it could not be created
+    static hipblas_stream_pool* get(hipblasHandle_t handle);
+
+    // Make the first count auxiliary handles follow handle: same pointer, math and atomics
+    // modes, and ordered after the work queued on its stream
+    hipblasStatus_t fork(hipblasHandle_t handle, size_t count);
+
+    // Order the stream of handle after the work queued on the first count auxiliary streams
+    hipblasStatus_t join(hipblasHandle_t handle, size_t count);
+
+    size_t size() const
+    {
+        return m_handles.size();
+    }
+
+    hipblasHandle_t operator[](size_t i) const
+    {
+        return hipblasHandle_t(m_handles[i]);
+    }
+
+    // One and zero in the precision of T, in host or device memory to match mode
+    template <typename T>
+    const T* one(hipblasPointerMode_t mode) const
+    {
+        const char* constants = mode == HIPBLAS_POINTER_MODE_DEVICE
+                                    ? static_cast<const char*>(m_device_constants)
+                                    : m_host_constants;
+        return reinterpret_cast<const T*>(constants + constant_offset<T>());
+    }
+
+    template <typename T>
+    const T* zero(hipblasPointerMode_t mode) const
+    {
+        return one<T>(mode) + 1;
+    }
+
+    // Serializes use of the auxiliary handles
+    std::mutex mutex;
+
+private:
+    hipblas_stream_pool() = default;
+    hipblasStatus_t init(size_t count);
+
+    // Constants are stored as {1, 0} pairs of float, double, float complex and double
+    // complex, 32 bytes apart
+    template <typename T>
+    static constexpr size_t constant_offset()
+    {
+        return std::is_floating_point<T>{} ? (sizeof(T) == 4 ? 0 : 32) : (sizeof(T) == 8 ? 64 : 96);
+    }
+
+    std::vector<cublasHandle_t> m_handles;
+    std::vector<cudaStream_t>   m_streams;
+    std::vector<cudaEvent_t>    m_events;
+    cudaEvent_t                 m_fork             = nullptr;
+    void*                       m_device_constants = nullptr;
+    char                        m_host_constants[128];
+};
+
+/*! \brief Run func(h, b) for every instance b in [0, batch_count) of a batched call.
+ *
+ *  h is the handle to queue instance b on: an auxiliary handle of the pool of handle, or handle
+ *  itself when the batch runs serially. Stops at, and returns, the first error. An empty or
+ *  negative batch is a quick return, as in rocBLAS; callers that must reject a negative
+ *  batch_count check it first.
+ */
+template <typename F>
+hipblasStatus_t hipblas_batched_execute(hipblasHandle_t handle, int64_t batch_count, F&& func)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_stream_pool* pool    = batch_count > 1 ? hipblas_stream_pool::get(handle) : nullptr;
+    size_t               streams = pool ? std::min(size_t(batch_count), pool->size()) : 0;
+    if(streams < 2)
+    {
+        for(int64_t b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = func(handle, b);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(pool->mutex);
+
+    hipblasStatus_t status = pool->fork(handle, streams);
+    for(int64_t b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = func((*pool)[b % streams], b);
+
+    hipblasStatus_t join_status = pool->join(handle, streams);
+    return status != HIPBLAS_STATUS_SUCCESS ? status : join_status;
+}
+
+// Size in bytes of one element of type
+size_t hipblas_datatype_size(cudaDataType_t type);
+
+// hipDataType and compute type of the real or complex precision T
+template <typename T>
+constexpr hipDataType hipblas_datatype()
+{
+    if constexpr(std::is_floating_point<T>{})
+        return sizeof(T) == 4 ? HIP_R_32F : HIP_R_64F;
+    else
+        return sizeof(T) == 8 ? HIP_C_32F : HIP_C_64F;
+}
+
+template <typename T>
+constexpr hipblasComputeType_t hipblas_compute_type()
+{
+    return hipblas_datatype<T>() == HIP_R_32F || hipblas_datatype<T>() == HIP_C_32F
+               ? HIPBLAS_COMPUTE_32F
+               : HIPBLAS_COMPUTE_64F;
+}
+
+// Defined in hipblas.cpp
+extern "C" hipblasStatus_t   hipblasConvertStatus(cublasStatus_t cuStatus);
+extern "C" cublasOperation_t hipblasConvertOperation(hipblasOperation_t op);
+
+/*! \brief A strided-batched GEMM queued by hipBLAS itself to emulate another function.
+ *
+ *  Calls cuBLAS directly rather than hipblasGemmStridedBatchedEx_v2: the operands are laid out
+ *  by the emulation, so the row-major order and the GEMM epilogue set on the handle for the
+ *  calls of the user must not apply to them.
+ */
+template <typename T>
+hipblasStatus_t hipblas_internal_gemm_strided_batched(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transa,
+                                                      hipblasOperation_t transb,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const T*           alpha,
+                                                      const T*           A,
+                                                      int                lda,
+                                                      hipblasStride      stride_A,
+                                                      const T*           B,
+                                                      int                ldb,
+                                                      hipblasStride      stride_B,
+                                                      const T*           beta,
+                                                      T*                 C,
+                                                      int                ldc,
+                                                      hipblasStride      stride_C,
+                                                      int                batch_count)
+{
+    constexpr cudaDataType_t type
+        = hipblas_datatype<T>() == HIP_R_32F   ? CUDA_R_32F
+          : hipblas_datatype<T>() == HIP_R_64F ? CUDA_R_64F
+          : hipblas_datatype<T>() == HIP_C_32F ? CUDA_C_32F
+                                               : CUDA_C_64F;
+    constexpr cublasComputeType_t compute_type
+        = hipblas_compute_type<T>() == HIPBLAS_COMPUTE_32F ? CUBLAS_COMPUTE_32F
+                                                           : CUBLAS_COMPUTE_64F;
+    return hipblasConvertStatus(cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                                           hipblasConvertOperation(transa),
+                                                           hipblasConvertOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A,
+                                                           type,
+                                                           lda,
+                                                           stride_A,
+                                                           B,
+                                                           type,
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           C,
+                                                           type,
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           compute_type,
+                                                           CUBLAS_GEMM_DEFAULT));
+}
+
+/*! \brief y_i += alpha * x_i for every instance as one strided-batched GEMM.
+ *
+ *  Each y_i is an n x 1 matrix updated with the product of x_i, seen as the transpose of a
+ *  1 x n matrix with leading dimension incx, and a 1 x 1 matrix holding one. Requires incy == 1
+ *  and incx > 0; returns HIPBLAS_STATUS_NOT_SUPPORTED without doing anything otherwise.
+ */
+template <typename T>
+hipblasStatus_t hipblas_axpy_strided_batched_gemm(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const T*        alpha,
+                                                  const T*        x,
+                                                  int64_t         incx,
+                                                  hipblasStride   stridex,
+                                                  T*              y,
+                                                  int64_t         incy,
+                                                  hipblasStride   stridey,
+                                                  int64_t         batch_count)
+{
+    if(!handle || n <= 0 || incx <= 0 || incy != 1 || batch_count < 2 || n > INT32_MAX
+       || incx > INT32_MAX || batch_count > INT32_MAX)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_stream_pool* pool = hipblas_stream_pool::get(handle);
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_internal_gemm_strided_batched(handle,
+                                                 HIPBLAS_OP_T,
+                                                 HIPBLAS_OP_N,
+                                                 int(n),
+                                                 1,
+                                                 1,
+                                                 alpha,
+                                                 x,
+                                                 int(incx),
+                                                 stridex,
+                                                 pool->one<T>(HIPBLAS_POINTER_MODE_DEVICE),
+                                                 1,
+                                                 0,
+                                                 pool->one<T>(mode),
+                                                 y,
+                                                 int(n),
+                                                 stridey,
+                                                 int(batch_count));
+}
+
+/*! \brief result_i = x_i . y_i (conjugating x_i when CONJ) for every instance as one
+ *         strided-batched GEMM producing 1 x 1 matrices.
+ *
+ *  Only used in device pointer mode, where result is device memory GEMM can write to. Requires
+ *  incx > 0 (incx == 1 when CONJ) and incy > 0; returns HIPBLAS_STATUS_NOT_SUPPORTED without
+ *  doing anything otherwise.
+ */
+template <bool CONJ, typename T>
+hipblasStatus_t hipblas_dot_strided_batched_gemm(hipblasHandle_t handle,
+                                                 int64_t         n,
+                                                 const T*        x,
+                                                 int64_t         incx,
+                                                 hipblasStride   stridex,
+                                                 const T*        y,
+                                                 int64_t         incy,
+                                                 hipblasStride   stridey,
+                                                 int64_t         batch_count,
+                                                 T*              result)
+{
+    if(!handle || n <= 0 || incx <= 0 || (CONJ && incx != 1) || incy <= 0 || batch_count < 2
+       || n > INT32_MAX || incx > INT32_MAX || incy > INT32_MAX || batch_count > INT32_MAX)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(mode != HIPBLAS_POINTER_MODE_DEVICE)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_stream_pool* pool = hipblas_stream_pool::get(handle);
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // op(A) is 1 x n: x_i as a row with stride incx, or the conjugate transpose of x_i as a
+    // contiguous column. op(B) is n x 1: the transpose of y_i as a row with stride incy.
+    return hipblas_internal_gemm_strided_batched(handle,
+                                                 CONJ ? HIPBLAS_OP_C : HIPBLAS_OP_N,
+                                                 HIPBLAS_OP_T,
+                                                 1,
+                                                 1,
+                                                 int(n),
+                                                 pool->one<T>(mode),
+                                                 x,
+                                                 CONJ ? int(n) : int(incx),
+                                                 stridex,
+                                                 y,
+                                                 int(incy),
+                                                 stridey,
+                                                 pool->zero<T>(mode),
+                                                 result,
+                                                 1,
+                                                 1,
+                                                 int(batch_count));
+}
+
+/*! \brief Copy x_i to y_i for every instance with one 2D memory copy on the stream of handle.
+ *
+ *  Requires contiguous vectors that do not overlap between instances; returns
+ *  HIPBLAS_STATUS_NOT_SUPPORTED without doing anything otherwise.
+ */
+template <typename T>
+hipblasStatus_t hipblas_copy_strided_batched_memcpy(hipblasHandle_t handle,
+                                                    int64_t         n,
+                                                    const T*        x,
+                                                    int64_t         incx,
+                                                    hipblasStride   stridex,
+                                                    T*              y,
+                                                    int64_t         incy,
+                                                    hipblasStride   stridey,
+                                                    int64_t         batch_count)
+{
+    if(!handle || n <= 0 || incx != 1 || incy != 1 || batch_count < 2 || stridex < n
+       || stridey < n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    cudaStream_t   stream;
+    cublasStatus_t status = cublasGetStream((cublasHandle_t)handle, &stream);
+    if(status != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return cudaMemcpy2DAsync(y,
+                             sizeof(T) * stridey,
+                             x,
+                             sizeof(T) * stridex,
+                             sizeof(T) * n,
+                             batch_count,
+                             cudaMemcpyDeviceToDevice,
+                             stream)
+                   == cudaSuccess
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+// False when handle is in graph capture safe mode or stream is being captured. Calls on handle
+// must then neither allocate device memory nor read from or copy host memory on stream.
+bool hipblas_may_allocate(hipblasHandle_t handle, cudaStream_t stream);
+
+/*! \brief Temporary device memory, allocated and released in the order of the work queued on
+ *         a stream, so that it can be used by asynchronous work without synchronizing.
+ *
+ *  Nothing is allocated when hipblas_may_allocate is false for handle; status() then returns
+ *  HIPBLAS_STATUS_NOT_SUPPORTED, and HIPBLAS_STATUS_ALLOC_FAILED if the allocation failed.
+ */
+class hipblas_stream_buffer
+{
+public:
+    hipblas_stream_buffer(hipblasHandle_t handle, cudaStream_t stream, size_t bytes)
+        : m_stream(stream)
+    {
+        if(!hipblas_may_allocate(handle, stream))
+            m_status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        else if(bytes && cudaMallocAsync(&m_ptr, bytes, stream) != cudaSuccess)
+        {
+            m_ptr    = nullptr;
+            m_status = HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    ~hipblas_stream_buffer()
+    {
+        if(m_ptr)
+            cudaFreeAsync(m_ptr, m_stream);
+    }
+
+    hipblas_stream_buffer(const hipblas_stream_buffer&) = delete;
+    hipblas_stream_buffer& operator=(const hipblas_stream_buffer&) = delete;
+
+    // nullptr if nothing was allocated
+    void* get() const
+    {
+        return m_ptr;
+    }
+
+    hipblasStatus_t status() const
+    {
+        return m_status;
+    }
+
+private:
+    cudaStream_t    m_stream;
+    void*           m_ptr    = nullptr;
+    hipblasStatus_t m_status = HIPBLAS_STATUS_SUCCESS;
+};
+
+/*! \brief Dense layout for the instances of a banded or packed strided batch.
+ *
+ *  Every instance of the dense batch is a matrix with leading dimension ld, stride elements
+ *  apart. It is built by zero filling and then copying each strip from the source batch.
+ */
+struct hipblas_dense_expansion
+{
+    // len elements read src_step apart from src_offset in a source instance, written dst_step
+    // apart from dst_offset in the dense instance
+    struct strip
+    {
+        int64_t src_offset;
+        int64_t src_step;
+        int64_t dst_offset;
+        int64_t dst_step;
+        int64_t len;
+    };
+
+    int64_t            ld;
+    hipblasStride      stride;
+    std::vector<strip> strips;
+};
+
+// Builders of the expansion of one kind of matrix; the expansion has no strips if the
+// dimensions are not valid for that kind
+
+// Expansion of the m x n general band matrices with kl sub- and ku super-diagonals
+hipblas_dense_expansion
+    hipblas_gbmv_expansion(int64_t m, int64_t n, int64_t kl, int64_t ku, int64_t lda);
+
+// Expansion of the n x n symmetric band matrices with k off-diagonals stored in uplo
+hipblas_dense_expansion
+    hipblas_sbmv_expansion(hipblasFillMode_t uplo, int64_t n, int64_t k, int64_t lda);
+
+// Expansion of the n x n symmetric packed matrices stored in uplo
+hipblas_dense_expansion hipblas_spmv_expansion(hipblasFillMode_t uplo, int64_t n);
+
+/*! \brief Queue on stream the expansion of batch_count instances of size bytes elements,
+ *         src_stride elements apart in src, into dense.
+ *
+ *  Each strip is copied for the whole batch at once. Returns HIPBLAS_STATUS_NOT_SUPPORTED if a
+ *  strip cannot be described as a 3D copy of the two batches; src is never modified.
+ */
+hipblasStatus_t hipblas_expand_strided_batched(cudaStream_t                   stream,
+                                               size_t                         size,
+                                               const void*                    src,
+                                               hipblasStride                  src_stride,
+                                               void*                          dense,
+                                               const hipblas_dense_expansion& expansion,
+                                               int64_t                        batch_count);
+
+/*! \brief y_i = alpha * op(A_i) * x_i + beta * y_i for a strided batch of banded or packed
+ *         matrices A_i, by expanding them into dense matrices and running one strided-batched
+ *         GEMV.
+ *
+ *  The GEMV is queued as a strided-batched GEMM with a single column so that every precision
+ *  shares it. The expansion costs one copy per strip, so it is only used when there are fewer
+ *  strips than instances and the dense batch fits in a bounded temporary buffer. Requires
+ *  incx > 0 and incy == 1. Returns HIPBLAS_STATUS_NOT_SUPPORTED without touching y otherwise, or
+ *  if the temporary buffer or the expansion cannot be queued.
+ */
+template <typename T>
+hipblasStatus_t hipblas_gemv_expanded_strided_batched(hipblasHandle_t                handle,
+                                                      hipblasOperation_t             trans,
+                                                      int64_t                        m,
+                                                      int64_t                        n,
+                                                      const T*                       alpha,
+                                                      const T*                       A,
+                                                      hipblasStride                  strideA,
+                                                      const hipblas_dense_expansion& expansion,
+                                                      const T*                       x,
+                                                      int64_t                        incx,
+                                                      hipblasStride                  stridex,
+                                                      const T*                       beta,
+                                                      T*                             y,
+                                                      int64_t                        incy,
+                                                      hipblasStride                  stridey,
+                                                      int64_t                        batch_count)
+{
+    constexpr size_t max_bytes = size_t(64) << 20;
+
+    int64_t rows = trans == HIPBLAS_OP_N ? m : n;
+    int64_t cols = trans == HIPBLAS_OP_N ? n : m;
+    if(!handle || m <= 0 || n <= 0 || incx <= 0 || incy != 1 || batch_count < 2
+       || expansion.strips.empty() || int64_t(expansion.strips.size()) >= batch_count
+       || expansion.stride > INT32_MAX
+       || size_t(expansion.stride) * batch_count > max_bytes / sizeof(T) || rows > INT32_MAX
+       || cols > INT32_MAX || incx > INT32_MAX || batch_count > INT32_MAX)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_stream_buffer dense(handle, stream, sizeof(T) * expansion.stride * batch_count);
+    if(!dense.get())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasStatus_t status = hipblas_expand_strided_batched(
+        stream, sizeof(T), A, strideA, dense.get(), expansion, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        // op(B) is the cols x 1 transpose of x_i seen as a row with stride incx
+        status = hipblas_internal_gemm_strided_batched(handle,
+                                                       trans,
+                                                       HIPBLAS_OP_T,
+                                                       int(rows),
+                                                       1,
+                                                       int(cols),
+                                                       alpha,
+                                                       static_cast<const T*>(dense.get()),
+                                                       int(expansion.ld),
+                                                       expansion.stride,
+                                                       x,
+                                                       int(incx),
+                                                       stridex,
+                                                       beta,
+                                                       y,
+                                                       int(rows),
+                                                       stridey,
+                                                       int(batch_count));
+    }
+    return status;
+}
+
+/*! \brief The instances of one operand of a batched call: either a base pointer and a stride
+ *         in elements, or a device array of pointers.
+ */
+class hipblas_batch
+{
+public:
+    template <typename T>
+    hipblas_batch(T* base, hipblasStride stride)
+        : m_base(base)
+        , m_stride_bytes(sizeof(T) * stride)
+    {
+    }
+
+    template <typename T>
+    hipblas_batch(T* const array[])
+        : m_array((const void* const*)array)
+    {
+    }
+
+    // Append the pointers to the batch_count instances to pointers. A device array is read back,
+    // which waits for the work queued on stream; HIPBLAS_STATUS_NOT_SUPPORTED is returned instead
+    // when handle is in graph capture safe mode or stream is being captured.
+    hipblasStatus_t append(hipblasHandle_t           handle,
+                           cudaStream_t              stream,
+                           int64_t                   batch_count,
+                           std::vector<const void*>& pointers) const;
+
+private:
+    const void*        m_base         = nullptr;
+    int64_t            m_stride_bytes = 0;
+    const void* const* m_array        = nullptr;
+};
+
+/*! \brief Run func(arrays) for a pointer-array routine called on batches that may be strided.
+ *
+ *  arrays is a device array holding the pointers to the batch_count instances of each of
+ *  operands in turn; it is released after the work func queues on the stream of handle.
+ *  Returns HIPBLAS_STATUS_NOT_SUPPORTED without calling func when hipblas_may_allocate is false.
+ */
+template <typename F>
+hipblasStatus_t hipblas_with_pointer_arrays(hipblasHandle_t                      handle,
+                                            std::initializer_list<hipblas_batch> operands,
+                                            int64_t                              batch_count,
+                                            F&&                                  func)
+{
+    cudaStream_t stream;
+    if(cublasGetStream((cublasHandle_t)handle, &stream) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::vector<const void*> pointers;
+    for(const hipblas_batch& operand : operands)
+    {
+        hipblasStatus_t status = operand.append(handle, stream, batch_count, pointers);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    if(pointers.empty())
+        return func(nullptr);
+
+    size_t                bytes = sizeof(const void*) * pointers.size();
+    hipblas_stream_buffer arrays(handle, stream, bytes);
+    if(arrays.status() != HIPBLAS_STATUS_SUCCESS)
+        return arrays.status();
+    if(cudaMemcpyAsync(arrays.get(), pointers.data(), bytes, cudaMemcpyHostToDevice, stream)
+       != cudaSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    return func(static_cast<const void* const*>(arrays.get()));
+}
+
+/*! \brief One GEMM of the decomposition of a structured Level 3 routine, repeated for every
+ *         instance of the batch.
+ *
+ *  The left operand is A, B or the device constant one (for a unit diagonal), the right operand
+ *  A or B, and the result C; each starts at element (row, col) of its matrix. Tasks of the same
+ *  phase update disjoint parts of C, and phases run in increasing order.
+ */
+struct hipblas_gemm_task
+{
+    enum operand
+    {
+        A,
+        B,
+        ONE
+    };
+    enum scale
+    {
+        BETA,
+        BETA_ONE,
+        BETA_ZERO
+    };
+
+    int                phase;
+    hipblasOperation_t transA;
+    hipblasOperation_t transB;
+    int64_t            m;
+    int64_t            n;
+    int64_t            k;
+    operand            left;
+    int64_t            left_row;
+    int64_t            left_col;
+    operand            right;
+    int64_t            right_row;
+    int64_t            right_col;
+    int64_t            c_row;
+    int64_t            c_col;
+    scale              beta;
+};
+
+// Decompositions into GEMMs over a binary splitting of the triangle, down to single diagonal
+// elements, so the flop count is that of the routine itself
+
+// C = alpha * op(A) op(B)^T [+ alpha * op(B) op(A)^T when rank2] + beta * C on the uplo triangle
+std::vector<hipblas_gemm_task> hipblas_syr2k_tasks(hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t trans,
+                                                   int64_t            n,
+                                                   int64_t            k,
+                                                   bool               rank2);
+
+// C = alpha * A B + beta * C (left) or alpha * B A + beta * C (right), A symmetric in uplo
+std::vector<hipblas_gemm_task>
+    hipblas_symm_tasks(hipblasSideMode_t side, hipblasFillMode_t uplo, int64_t m, int64_t n);
+
+// C = alpha * op(A) B (left) or alpha * B op(A) (right), A triangular in uplo
+std::vector<hipblas_gemm_task> hipblas_trmm_tasks(hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t trans,
+                                                  hipblasDiagType_t  diag,
+                                                  int64_t            m,
+                                                  int64_t            n);
+
+// Operands of the GEMMs of a decomposition
+struct hipblas_gemm_task_args
+{
+    hipDataType          type;
+    size_t               size;
+    hipblasComputeType_t compute_type;
+    const void*          alpha;
+    const void*          beta[3];
+    const void*          device_one;
+    hipblas_batch        A;
+    int64_t              lda;
+    hipblas_batch        B;
+    int64_t              ldb;
+    hipblas_batch        C;
+    int64_t              ldc;
+};
+
+/*! \brief Queue tasks for every instance of the batch, as one pointer-array batched GEMM per
+ *         phase and shape.
+ *
+ *  Returns HIPBLAS_STATUS_NOT_SUPPORTED without doing anything if the GEMMs cannot be expressed
+ *  with 32-bit sizes or the pointer arrays cannot be allocated, which includes when
+ *  hipblas_may_allocate is false.
+ */
+hipblasStatus_t hipblas_gemm_tasks_execute(hipblasHandle_t                       handle,
+                                           const std::vector<hipblas_gemm_task>& tasks,
+                                           const hipblas_gemm_task_args&         args,
+                                           int64_t                               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_gemm_tasks_execute(hipblasHandle_t                       handle,
+                                           const std::vector<hipblas_gemm_task>& tasks,
+                                           const T*                              alpha,
+                                           hipblas_batch                         A,
+                                           int64_t                               lda,
+                                           hipblas_batch                         B,
+                                           int64_t                               ldb,
+                                           const T*                              beta,
+                                           hipblas_batch                         C,
+                                           int64_t                               ldc,
+                                           int64_t                               batch_count)
+{
+    if(!handle || tasks.empty() || batch_count < 2)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_stream_pool* pool = hipblas_stream_pool::get(handle);
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_gemm_task_args args{hipblas_datatype<T>(),
+                                sizeof(T),
+                                hipblas_compute_type<T>(),
+                                alpha,
+                                {beta, pool->one<T>(mode), pool->zero<T>(mode)},
+                                pool->one<T>(HIPBLAS_POINTER_MODE_DEVICE),
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                C,
+                                ldc};
+    return hipblas_gemm_tasks_execute(handle, tasks, args, batch_count);
+}
+
+/*! \brief syrk, syrkx and syr2k on a batch as GEMMs on the tiles of the uplo triangle.
+ *
+ *  Requires valid arguments and trans N or T (C for real types); returns
+ *  HIPBLAS_STATUS_NOT_SUPPORTED without doing anything otherwise, so that the routine itself
+ *  reports the error.
+ */
+template <typename T>
+hipblasStatus_t hipblas_syr2k_gemm(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t trans,
+                                   int64_t            n,
+                                   int64_t            k,
+                                   const T*           alpha,
+                                   hipblas_batch      A,
+                                   int64_t            lda,
+                                   hipblas_batch      B,
+                                   int64_t            ldb,
+                                   const T*           beta,
+                                   hipblas_batch      C,
+                                   int64_t            ldc,
+                                   int64_t            batch_count,
+                                   bool               rank2)
+{
+    constexpr bool real = std::is_floating_point<T>{};
+    if(trans == HIPBLAS_OP_C && real)
+        trans = HIPBLAS_OP_T;
+
+    int64_t rows = trans == HIPBLAS_OP_N ? n : k;
+    if(trans == HIPBLAS_OP_C || n <= 0 || k < 0 || lda < std::max<int64_t>(1, rows)
+       || ldb < std::max<int64_t>(1, rows) || ldc < n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_gemm_tasks_execute(handle,
+                                      hipblas_syr2k_tasks(uplo, trans, n, k, rank2),
+                                      alpha,
+                                      A,
+                                      lda,
+                                      B,
+                                      ldb,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      batch_count);
+}
+
+/*! \brief symm on a batch as GEMMs on the tiles of the uplo triangle of A.
+ *
+ *  Requires valid arguments; returns HIPBLAS_STATUS_NOT_SUPPORTED without doing anything
+ *  otherwise.
+ */
+template <typename T>
+hipblasStatus_t hipblas_symm_gemm(hipblasHandle_t   handle,
+                                  hipblasSideMode_t side,
+                                  hipblasFillMode_t uplo,
+                                  int64_t           m,
+                                  int64_t           n,
+                                  const T*          alpha,
+                                  hipblas_batch     A,
+                                  int64_t           lda,
+                                  hipblas_batch     B,
+                                  int64_t           ldb,
+                                  const T*          beta,
+                                  hipblas_batch     C,
+                                  int64_t           ldc,
+                                  int64_t           batch_count)
+{
+    int64_t ka = side == HIPBLAS_SIDE_LEFT ? m : n;
+    if(m <= 0 || n <= 0 || lda < ka || ldb < m || ldc < m)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_gemm_tasks_execute(handle,
+                                      hipblas_symm_tasks(side, uplo, m, n),
+                                      alpha,
+                                      A,
+                                      lda,
+                                      B,
+                                      ldb,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      batch_count);
+}
+
+/*! \brief Out-of-place trmm on a strided batch as GEMMs on the tiles of the uplo triangle of
+ *         A.
+ *
+ *  Every row (left) or column (right) of C is first written from the diagonal of A, then
+ *  accumulates the off-diagonal tiles, so C must not overlap B. Requires valid arguments;
+ *  returns HIPBLAS_STATUS_NOT_SUPPORTED without doing anything otherwise.
+ */
+template <typename T>
+hipblasStatus_t hipblas_trmm_strided_batched_gemm(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t trans,
+                                                  hipblasDiagType_t  diag,
+                                                  int64_t            m,
+                                                  int64_t            n,
+                                                  const T*           alpha,
+                                                  const T*           A,
+                                                  int64_t            lda,
+                                                  hipblasStride      strideA,
+                                                  const T*           B,
+                                                  int64_t            ldb,
+                                                  hipblasStride      strideB,
+                                                  T*                 C,
+                                                  int64_t            ldc,
+                                                  hipblasStride      strideC,
+                                                  int64_t            batch_count)
+{
+    int64_t ka = side == HIPBLAS_SIDE_LEFT ? m : n;
+    if(m <= 0 || n <= 0 || lda < ka || ldb < m || ldc < m || batch_count < 2)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The spans of the whole B and C batches must be disjoint
+    const T* b_first = B + std::min<hipblasStride>(0, strideB * (batch_count - 1));
+    const T* b_last  = B + std::max<hipblasStride>(0, strideB * (batch_count - 1)) + ldb * n;
+    const T* c_first = C + std::min<hipblasStride>(0, strideC * (batch_count - 1));
+    const T* c_last  = C + std::max<hipblasStride>(0, strideC * (batch_count - 1)) + ldc * n;
+    if(c_first < b_last && b_first < c_last)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblas_gemm_tasks_execute(handle,
+                                      hipblas_trmm_tasks(side, uplo, trans, diag, m, n),
+                                      alpha,
+                                      hipblas_batch(A, strideA),
+                                      lda,
+                                      hipblas_batch(B, strideB),
+                                      ldb,
+                                      (const T*)nullptr,
+                                      hipblas_batch(C, strideC),
+                                      ldc,
+                                      batch_count);
+}
+
+// Whether the instances of a strided batch of matrices with n columns are, one after the
+// other, the columns of a single matrix with n * batch_count columns
+inline bool
+    hipblas_batch_as_columns(int64_t n, int64_t ld, hipblasStride stride, int64_t batch_count)
+{
+    return n > 0 && stride == ld * n && n * batch_count <= INT32_MAX;
+}
+
+/*! \brief Largest piece, in elements, instances, rows or columns, that the 64-bit interface
+ *         issues to the 32-bit cuBLAS API at once.
+ *
+ *  INT32_MAX unless the HIPBLAS_NVIDIA_ILP64_CHUNK environment variable sets a smaller size,
+ *  which exercises the splitting without allocating more than 2^31 elements.
+ */
+int64_t hipblas_ilp64_chunk();
+
+// Whether every value is representable in the 32-bit interface
+template <typename... Ts>
+bool hipblas_fits_int32(Ts... values)
+{
+    bool fits = true;
+    for(int64_t v : std::initializer_list<int64_t>{int64_t(values)...})
+        fits = fits && v >= INT32_MIN && v <= INT32_MAX;
+    return fits;
+}
+
+/*! \brief Run func(first, count) for consecutive pieces [first, first + count) of [0, total)
+ *         no larger than hipblas_ilp64_chunk(), in order, on the stream of the handle.
+ *
+ *  A total that already fits is passed through in one piece, so that the 32-bit routine still
+ *  sees, and validates, an empty or negative size. Stops at, and returns, the first error.
+ */
+template <typename F>
+hipblasStatus_t hipblas_ilp64_chunks(int64_t total, F&& func)
+{
+    const int64_t chunk = hipblas_ilp64_chunk();
+    if(total <= chunk)
+        return func(int64_t(0), int(std::max<int64_t>(total, INT32_MIN)));
+
+    for(int64_t first = 0; first < total; first += chunk)
+    {
+        hipblasStatus_t status = func(first, int(std::min(chunk, total - first)));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Offset of the piece [first, first + count) of a vector of n elements with increment inc;
+// with a negative increment the elements are stored last to first
+inline int64_t hipblas_ilp64_offset(int64_t n, int64_t first, int64_t count, int64_t inc)
+{
+    return inc >= 0 ? first * inc : (n - first - count) * -inc;
+}
+
+// Offsets of row i and of column j of op(A) in A
+inline int64_t hipblas_op_row_offset(hipblasOperation_t op, int64_t i, int64_t ld)
+{
+    return op == HIPBLAS_OP_N ? i : i * ld;
+}
+
+inline int64_t hipblas_op_col_offset(hipblasOperation_t op, int64_t j, int64_t ld)
+{
+    return op == HIPBLAS_OP_N ? j * ld : j;
+}